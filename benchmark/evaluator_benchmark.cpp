@@ -0,0 +1,79 @@
+#include "Bezier/bezier.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+/*!
+ * Compare accuracy and speed of evaluation engines for curves of increasing order.
+ * Accuracy is measured against de Casteljau's algorithm in long double precision.
+ */
+
+using namespace Bezier;
+
+static Point reference(const PointVector& points, long double t)
+{
+  std::vector<long double> x(points.size()), y(points.size());
+  for (size_t k = 0; k < points.size(); k++)
+  {
+    x[k] = points[k].x();
+    y[k] = points[k].y();
+  }
+  for (size_t m = points.size() - 1; m > 0; m--)
+    for (size_t k = 0; k < m; k++)
+    {
+      x[k] = (1 - t) * x[k] + t * x[k + 1];
+      y[k] = (1 - t) * y[k] + t * y[k + 1];
+    }
+  return Point(static_cast<double>(x[0]), static_cast<double>(y[0]));
+}
+
+static void benchmark(Curve& curve, Evaluator evaluator, const Curve::VectorX& t, const Curve::MatrixX2& expected,
+                      double& error, double& time)
+{
+  curve.setEvaluator(evaluator);
+  curve.valueAt(0.5); // warm up caches
+
+  const int repeat = 20;
+  Point sum(0, 0);
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeat; r++)
+    for (Eigen::Index k = 0; k < t.size(); k++)
+      sum += curve.valueAt(t(k));
+  auto end = std::chrono::steady_clock::now();
+  volatile double sink = sum.x(); // keep evaluation from being optimized out
+  (void)sink;
+  time = std::chrono::duration<double, std::nano>(end - start).count() / (repeat * t.size());
+
+  error = 0;
+  for (Eigen::Index k = 0; k < t.size(); k++)
+    error = std::max(error, (curve.valueAt(t(k)) - expected.row(k).transpose()).norm());
+}
+
+int main()
+{
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-100, 100);
+  Curve::VectorX t = Curve::VectorX::LinSpaced(1000, 0, 1);
+
+  std::printf("%5s | %12s %12s | %14s %13s\n", "order", "power [ns]", "power err", "casteljau [ns]",
+              "casteljau err");
+  for (uint order : {1, 2, 3, 5, 7, 10, 15, 20, 25, 30, 40, 50, 63})
+  {
+    PointVector points;
+    for (uint k = 0; k <= order; k++)
+      points.emplace_back(distribution(generator), distribution(generator));
+
+    Curve::MatrixX2 expected(t.size(), 2);
+    for (Eigen::Index k = 0; k < t.size(); k++)
+      expected.row(k) = reference(points, t(k));
+
+    Curve curve(points);
+    double power_error, power_time, casteljau_error, casteljau_time;
+    benchmark(curve, Evaluator::PowerBasis, t, expected, power_error, power_time);
+    benchmark(curve, Evaluator::DeCasteljau, t, expected, casteljau_error, casteljau_time);
+    std::printf("%5u | %12.1f %12.3g | %14.1f %13.3g\n", order, power_time, power_error, casteljau_time,
+                casteljau_error);
+  }
+  return 0;
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2019 Mirko Kokot
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BERNSTEIN_ROOTS_H
+#define BERNSTEIN_ROOTS_H
+
+#include <cmath>
+#include <cstddef>
+
+namespace Bezier
+{
+/*!
+ * \brief Isolate and polish roots of a polynomial given by its Bernstein coefficients on [t1, t2]
+ *
+ * Endpoint roots are factored out first, so interval ends are never zero. By the variation
+ * diminishing property, no sign change among coefficients means no root and exactly one sign
+ * change means exactly one root, which is found by bisection-safeguarded Newton. Otherwise the
+ * interval is split in half with de Casteljau's algorithm. Roots are appended in ascending order,
+ * a root on the border of two halves may be appended twice.
+ *
+ * Buffers are copied for halves of the interval, so a std::array keeps the search free of heap allocations.
+ * \param coeffs Buffer (std::vector or std::array) holding Bernstein coefficients (consumed)
+ * \param size Number of coefficients in buffer
+ * \param t1 Start of interval
+ * \param t2 End of interval
+ * \param epsilon Precision of resulting t
+ * \param max_iter Maximum number of Newton iterations per root
+ * \param append Function called with each root
+ */
+template <typename Buffer, typename Append>
+void bernsteinRoots(Buffer& coeffs, std::size_t size, typename Buffer::value_type t1, typename Buffer::value_type t2,
+                    typename Buffer::value_type epsilon, std::size_t max_iter, Append&& append)
+{
+  using Scalar = typename Buffer::value_type;
+
+  // factor out u (or 1 - u) for a root at the start (or end) of interval
+  bool root_at_t2 = false;
+  while (size > 1 && coeffs[0] == 0)
+  {
+    append(t1);
+    const std::size_t degree = size - 1;
+    for (std::size_t k = 0; k < degree; k++)
+      coeffs[k] = coeffs[k + 1] * degree / (k + 1);
+    size--;
+  }
+  while (size > 1 && coeffs[size - 1] == 0)
+  {
+    root_at_t2 = true;
+    const std::size_t degree = size - 1;
+    for (std::size_t k = 0; k < degree; k++)
+      coeffs[k] = coeffs[k] * degree / (degree - k);
+    size--;
+  }
+
+  unsigned variations = 0;
+  for (std::size_t k = 1, last = 0; k < size; k++)
+    if (coeffs[k] != 0)
+    {
+      if ((coeffs[last] < 0) != (coeffs[k] < 0))
+        variations++;
+      last = k;
+    }
+
+  if (variations == 1)
+  {
+    // evaluate polynomial and its derivative in local parameter u
+    Buffer buffer = coeffs;
+    auto evaluate = [&coeffs, &buffer, size](Scalar u, Scalar& f_d) {
+      for (std::size_t k = 0; k < size; k++)
+        buffer[k] = coeffs[k];
+      for (std::size_t n = size - 1; n > 1; n--)
+        for (std::size_t k = 0; k < n; k++)
+          buffer[k] = (1 - u) * buffer[k] + u * buffer[k + 1];
+      f_d = (size - 1) * (buffer[1] - buffer[0]);
+      return (1 - u) * buffer[0] + u * buffer[1];
+    };
+
+    const bool rising = coeffs[0] < 0;
+    const Scalar u_epsilon = epsilon / (t2 - t1);
+    Scalar u_low = 0, u_high = 1;
+    Scalar u = coeffs[0] / (coeffs[0] - coeffs[size - 1]);
+    for (std::size_t iter = 0; iter < max_iter; iter++)
+    {
+      Scalar f_d, f = evaluate(u, f_d);
+      if (f == 0)
+        break;
+      ((f < 0) == rising ? u_low : u_high) = u;
+
+      // fall back to bisection if Newton step leaves the bracket
+      Scalar u_new = u - f / f_d;
+      const bool newton = u_new > u_low && u_new < u_high;
+      if (!newton)
+        u_new = (u_low + u_high) / 2;
+      const Scalar delta = std::fabs(u_new - u);
+      u = u_new;
+      if ((newton && delta < u_epsilon) || u_high - u_low < u_epsilon)
+        break;
+    }
+    append(t1 + u * (t2 - t1));
+  }
+  else if (variations > 1)
+  {
+    const Scalar t_mid = (t1 + t2) / 2;
+    if (t2 - t1 < epsilon)
+    {
+      // cluster of roots, only an odd number of them changes sign
+      if ((coeffs[0] < 0) != (coeffs[size - 1] < 0))
+        append(t_mid);
+    }
+    else
+    {
+      // split in half, left half is built from the first coefficient of each level
+      Buffer left = coeffs;
+      for (std::size_t n = size; n > 0; n--)
+      {
+        left[size - n] = coeffs[0];
+        for (std::size_t k = 0; k + 1 < n; k++)
+          coeffs[k] = (coeffs[k] + coeffs[k + 1]) / 2;
+      }
+      bernsteinRoots(left, size, t1, t_mid, epsilon, max_iter, append);
+      bernsteinRoots(coeffs, size, t_mid, t2, epsilon, max_iter, append);
+    }
+  }
+
+  if (root_at_t2)
+    append(t2);
+}
+
+} // namespace Bezier
+
+#endif // BERNSTEIN_ROOTS_H
@@ -17,7 +17,9 @@
 #ifndef BEZIER_H
 #define BEZIER_H
 
-#include <map>
+#include <array>
+#include <atomic>
+#include <mutex>
 
 #include "declarations.h"
 
@@ -30,27 +32,55 @@ namespace Bezier
  * It uses private and static caching for storing often accessed data.
  * Private caching is used for data concerning individual curve, while
  * static caching is used for common data (coefficient matrices)
+ *
+ * Const member functions can be called concurrently on a shared curve,
+ * while modifying functions require exclusive access.
+ *
+ * \tparam Scalar Floating point type of coordinates and parameters
  */
-class Curve
+template <typename Scalar> class CurveT
 {
 public:
+  /// Point in xy plane
+  using Point = PointT<Scalar>;
+  /// A Vector in xy plane
+  using Vector = VectorT<Scalar>;
+  /// A vector of Points
+  using PointVector = PointVectorT<Scalar>;
+  /// Bounding box class
+  using BoundingBox = BoundingBoxT<Scalar>;
+  /// Mx2 matrix where each row is a point
+  using MatrixX2 = Eigen::Matrix<Scalar, Eigen::Dynamic, 2>;
+  /// A vector of parameters
+  using VectorX = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+
+  /*!
+   * \brief Curvature based measures of path quality
+   */
+  struct Functionals
+  {
+    Scalar bending_energy;      ///< Integral of squared curvature over arc length
+    Scalar curvature_variation; ///< Integral of absolute curvature derivative (by arc length) over arc length
+    Scalar max_curvature;       ///< Maximal absolute curvature at sampled parameters
+  };
+
   /*!
    * \brief Create the Bezier curve
    * \param points Nx2 matrix where each row is one of N control points that define the curve
    */
-  Curve(const Eigen::MatrixX2d& points);
+  CurveT(const MatrixX2& points);
 
   /*!
    * \brief Create the Bezier curve
    * \param points A vector of control points that define the curve
    */
-  Curve(const PointVector& points);
+  CurveT(const PointVector& points);
 
   /*!
    * \brief Create the Bezier curve copy
    * \param curve A Bezier curve to copy
    */
-  Curve(const Curve& curve);
+  CurveT(const CurveT& curve);
 
   /*!
    * \brief Get order of curve (Nth order curve is described with N+1 points);
@@ -58,6 +88,22 @@ public:
    */
   uint order();
 
+  /*!
+   * \brief Set the method used for evaluating points and derivatives
+   * \param evaluator Evaluation method
+   *
+   * De Casteljau's algorithm works directly on control points and does not
+   * allocate memory for curves up to order 63. It should be preferred for
+   * high order curves, where power basis loses precision.
+   */
+  void setEvaluator(Evaluator evaluator);
+
+  /*!
+   * \brief Get the method used for evaluating points and derivatives
+   * \return Evaluation method
+   */
+  Evaluator evaluator() const;
+
   /*!
    * \brief Get the control points
    * \return A vector of control points
@@ -76,31 +122,80 @@ public:
    * \param precision Minimal distance between two subsequent points
    * \return A vector of polyline vertices
    */
-  PointVector polyline(double smoothness = 1.0001, double precision = 1.0) const;
+  PointVector polyline(Scalar smoothness = 1.0001, Scalar precision = 1.0) const;
+
+  /*!
+   * \brief Set the number of Legendre-Gauss quadrature nodes used for computing arc length
+   * \param n Number of nodes (1 to 64), LEGENDRE_GAUSS_N at compile time by default
+   */
+  void setQuadratureNodes(uint n);
+
+  /*!
+   * \brief Get the number of Legendre-Gauss quadrature nodes used for computing arc length
+   * \return Number of nodes
+   */
+  uint quadratureNodes() const;
+
+  /*!
+   * \brief Get the default number of Legendre-Gauss quadrature nodes, set with LEGENDRE_GAUSS_N when library is built
+   * \return Number of nodes
+   */
+  static uint defaultQuadratureNodes();
+
+  /*!
+   * \brief Use a table of cumulative arc length for computing length and iterating by length
+   *
+   * Table is generated on first use by integrating uniform parameter intervals. Length
+   * is then interpolated with cubic Hermite polynomials, and parameter for a given length
+   * with monotone cubic Hermite polynomials, making repeated queries almost constant time.
+   * \param intervals Number of uniform parameter intervals in the table
+   */
+  void enableArcLengthTable(uint intervals = 64);
+
+  /*!
+   * \brief Compute length with quadrature (default)
+   */
+  void disableArcLengthTable();
 
   /*!
    * \brief Compute exaxt arc length with Legendre-Gauss quadrature
    * \return Arc length
-   * \warning Precision depends on value of LEGENDRE_GAUSS_N at compile time
+   * \warning Precision depends on number of quadrature nodes
    */
-  double length() const;
+  Scalar length() const;
 
   /*!
    * \brief Compute exact arc length with Legendre-Gauss quadrature
    * \param t Curve parameter to which length is computed
    * \return Arc length from start to parameter t
-   * \warning Precision depends on value of LEGENDRE_GAUSS_N at compile time
+   * \warning Precision depends on number of quadrature nodes
    */
-  double length(double t) const;
+  Scalar length(Scalar t) const;
 
   /*!
    * \brief Compute exact arc length with Legendre-Gauss quadrature
    * \param t1 Curve parameter from which length is computed
    * \param t2 Curve parameter to which length is computed
    * \return Arc length between paramaters t1 and t2
-   * \warning Precision depends on value of LEGENDRE_GAUSS_N at compile time
+   * \warning Precision depends on number of quadrature nodes
    */
-  double length(double t1, double t2) const;
+  Scalar length(Scalar t1, Scalar t2) const;
+
+  /*!
+   * \brief Compute arc length with adaptive Gauss-Kronrod quadrature
+   *
+   * Interval is bisected only where the difference between 7-point Gauss
+   * and 15-point Kronrod estimates exceeds its share of the tolerance.
+   * Number of evaluated intervals is limited, so if the tolerance cannot be
+   * reached, the best estimate is returned and error is larger than tolerance.
+   * \param t1 Curve parameter from which length is computed
+   * \param t2 Curve parameter to which length is computed
+   * \param tolerance Wanted absolute error of arc length (must be positive)
+   * \param error If not null, set to the (conservative) estimate of absolute error
+   * \return Arc length between paramaters t1 and t2
+   * \throw std::invalid_argument If tolerance is not positive
+   */
+  Scalar length(Scalar t1, Scalar t2, Scalar tolerance, Scalar* error = nullptr) const;
 
   /*!
    * \brief Compute parameter t which is S distance from given t
@@ -110,7 +205,29 @@ public:
    * \param max_iter Maximum number of iterations for Newton-Rhapson
    * \return New parameter t
    */
-  double iterateByLength(double t, double s, double epsilon = 0.001, std::size_t max_iter = 15) const;
+  Scalar iterateByLength(Scalar t, Scalar s, Scalar epsilon = 0.001, std::size_t max_iter = 15) const;
+
+  /*!
+   * \brief Sample the curve at equal arc length distances
+   *
+   * Curve is traversed once, each sample is found from the previous one.
+   * \param spacing Arc length between two subsequent samples
+   * \param epsilon Precision of arc length of each sample
+   * \return Pair of vector of parameters t and Mx2 matrix of corresponding points
+   */
+  std::pair<VectorX, MatrixX2> resampleByLength(Scalar spacing, Scalar epsilon = 0.001) const;
+
+  /*!
+   * \brief Sample the curve at equal arc length distances into preallocated buffers
+   * \param spacing Arc length between two subsequent samples
+   * \param t_vector Buffer for parameters t of samples
+   * \param points Buffer for samples, Mx2 matrix where each row is a point
+   * \param offset Arc length from start of curve to the first sample
+   * \param epsilon Precision of arc length of each sample
+   * \return Number of samples on curve; if larger than size of buffers, only the first ones are written
+   */
+  uint resampleByLength(Scalar spacing, Eigen::Ref<VectorX> t_vector, Eigen::Ref<MatrixX2> points, Scalar offset = 0,
+                        Scalar epsilon = 0.001) const;
 
   /*!
    * \brief Reverse order of control points
@@ -132,7 +249,7 @@ public:
    * \warning Only works for quadratic and cubic curves
    * \warning Resets cached data
    */
-  void manipulateCurvature(double t, const Point& point);
+  void manipulateCurvature(Scalar t, const Point& point);
 
   /*!
    * \brief Raise the curve order by 1
@@ -155,21 +272,39 @@ public:
    * \param t Curve parameter
    * \return Point on a curve for a given t
    */
-  Point valueAt(double t) const;
+  Point valueAt(Scalar t) const;
+
+  /*!
+   * \brief Get the points on curve for a vector of parameters t
+   * \param t_vector A vector of curve parameters
+   * \return Mx2 matrix where each row is a point on a curve for corresponding t
+   */
+  MatrixX2 valueAt(const VectorX& t_vector) const;
 
   /*!
    * \brief Get curvature of curve for a given t
    * \param t Curve parameter
    * \return Curvature of a curve for a given t
    */
-  double curvatureAt(double t) const;
+  Scalar curvatureAt(Scalar t) const;
 
   /*!
    * \brief Get curvature derivative of curve for a given t
    * \param t Curve parameter
    * \return Curvature derivative of a curve for a given t
    */
-  double curvatureDerivativeAt(double t) const;
+  Scalar curvatureDerivativeAt(Scalar t) const;
+
+  /*!
+   * \brief Compute curvature based functionals in a single pass
+   *
+   * Integrals are computed with composite Legendre-Gauss quadrature, using the same
+   * derivative evaluations for all functionals. Maximal curvature is taken over
+   * quadrature nodes and end points.
+   * \param intervals Number of uniform parameter intervals with a quadrature each
+   * \return Bending energy, curvature variation and maximal curvature
+   */
+  Functionals functionals(uint intervals = 1) const;
 
   /*!
    * \brief Get the tangent of curve for a given t
@@ -177,7 +312,15 @@ public:
    * \param normalize If the resulting tangent should be normalized
    * \return Tangent of a curve for a given t
    */
-  Vector tangentAt(double t, bool normalize = true) const;
+  Vector tangentAt(Scalar t, bool normalize = true) const;
+
+  /*!
+   * \brief Get the tangents of curve for a vector of parameters t
+   * \param t_vector A vector of curve parameters
+   * \param normalize If the resulting tangents should be normalized
+   * \return Mx2 matrix where each row is a tangent of a curve for corresponding t
+   */
+  MatrixX2 tangentAt(const VectorX& t_vector, bool normalize = true) const;
 
   /*!
    * \brief Get the normal of curve for a given t
@@ -185,13 +328,21 @@ public:
    * \param normalize If the resulting normal should be normalized
    * \return Normal of a curve for given t
    */
-  Vector normalAt(double t, bool normalize = true) const;
+  Vector normalAt(Scalar t, bool normalize = true) const;
+
+  /*!
+   * \brief Get the normals of curve for a vector of parameters t
+   * \param t_vector A vector of curve parameters
+   * \param normalize If the resulting normals should be normalized
+   * \return Mx2 matrix where each row is a normal of a curve for corresponding t
+   */
+  MatrixX2 normalAt(const VectorX& t_vector, bool normalize = true) const;
 
   /*!
    * \brief Get the derivative of a curve
    * \return Derivative curve
    */
-  std::shared_ptr<const Curve> derivative() const;
+  std::shared_ptr<const CurveT> derivative() const;
 
   /*!
    * \brief Get the nth derivative of a curve
@@ -199,14 +350,21 @@ public:
    * \return Derivative curve
    * \warning Parameter n cannot be zero
    */
-  std::shared_ptr<const Curve> derivative(uint n) const;
+  std::shared_ptr<const CurveT> derivative(uint n) const;
 
   /*!
    * \brief Get value of a derivative for a given t
    * \param t Curve parameter
    * \return Derivative curve
    */
-  Point derivativeAt(double t) const;
+  Point derivativeAt(Scalar t) const;
+
+  /*!
+   * \brief Get values of a derivative for a vector of parameters t
+   * \param t_vector A vector of curve parameters
+   * \return Mx2 matrix where each row is a derivative for corresponding t
+   */
+  MatrixX2 derivativeAt(const VectorX& t_vector) const;
 
   /*!
    * \brief Get value of an nth derivative for a given t
@@ -214,16 +372,44 @@ public:
    * \param t Curve parameter
    * \return Derivative curve
    */
-  Point derivativeAt(uint n, double t) const;
+  Point derivativeAt(uint n, Scalar t) const;
+
+  /*!
+   * \brief Get values of an nth derivative for a vector of parameters t
+   * \param n Desired number of derivative
+   * \param t_vector A vector of curve parameters
+   * \return Mx2 matrix where each row is an nth derivative for corresponding t
+   */
+  MatrixX2 derivativeAt(uint n, const VectorX& t_vector) const;
+
+  /*!
+   * \brief Get the point and first k derivatives for a given t
+   * \param t Curve parameter
+   * \param k Number of derivatives
+   * \return (k+1)x2 matrix where row i is an ith derivative (row 0 is a point on a curve)
+   */
+  MatrixX2 jetAt(Scalar t, uint k) const;
+
+  /*!
+   * \brief Get the point and derivatives for a given t without allocation
+   * \param t Curve parameter
+   * \param jet Matrix to fill, row i is an ith derivative (number of rows defines number of derivatives)
+   */
+  void jetAt(Scalar t, Eigen::Ref<MatrixX2> jet) const;
 
   /*!
    * \brief Get the roots of curve on both axis
-   * \param step Size of step in coarse search
+   *
+   * For curves up to order 4 the derivative is at most cubic, and its roots
+   * are found analytically. Higher orders isolate every root by subdivision of
+   * the derivative's Bernstein coefficients and polish it with Newton-Rhapson.
+   * \param step Ignored, roots are isolated without a coarse search
    * \param epsilon Precision of resulting t
    * \param max_iter Maximum number of iterations for Newton-Rhapson
-   * \return A vector of extreme points
+   * \return A vector of extreme points, ordered by parameter t
+   * \deprecated Parameter step has no effect and will be removed
    */
-  PointVector roots(double step = 0.1, double epsilon = 0.001, std::size_t max_iter = 15) const;
+  PointVector roots(Scalar step = 0.1, Scalar epsilon = 0.001, std::size_t max_iter = 15) const;
 
   /*!
    * \brief Get the bounding box of curve
@@ -232,12 +418,66 @@ public:
    */
   BoundingBox boundingBox(bool use_roots = true) const;
 
+  /*!
+   * \brief Get the bounding box of curve aligned to its chord
+   *
+   * Box is the smallest rectangle containing control points, with sides parallel
+   * and perpendicular to the line between end points (or to x axis if they coincide).
+   * \return A vector of 4 corners of the box in counterclockwise order
+   */
+  PointVector orientedBoundingBox() const;
+
+  /*!
+   * \brief Get the convex hull of control points, which contains the whole curve
+   * \return A vector of hull vertices in counterclockwise order (fewer than 3 if control points are collinear)
+   */
+  PointVector convexHull() const;
+
+  /*!
+   * \brief Get the parameters of inflection points, where curvature changes sign
+   * \param epsilon Precision of resulting t
+   * \param max_iter Maximum number of iterations for Newton-Rhapson
+   * \return A vector of parameters t in (0, 1), in ascending order
+   */
+  std::vector<Scalar> inflections(Scalar epsilon = 0.001, std::size_t max_iter = 15) const;
+
+  /*!
+   * \brief Get the parameters of local extremes of (signed) curvature
+   * \param epsilon Precision of resulting t
+   * \param max_iter Maximum number of iterations for Newton-Rhapson
+   * \return A vector of parameters t in (0, 1), in ascending order
+   */
+  std::vector<Scalar> curvatureExtrema(Scalar epsilon = 0.001, std::size_t max_iter = 15) const;
+
   /*!
    * \brief Split the curve into two subcurves
    * \param z Parameter t at which to split the curve
    * \return Pair of two subcurves
    */
-  std::pair<Curve, Curve> splitCurve(double z = 0.5) const;
+  std::pair<CurveT, CurveT> splitCurve(Scalar z = 0.5) const;
+
+  /*!
+   * \brief Split the curve into two subcurves without allocation
+   * \param z Parameter t at which to split the curve
+   * \param left Nx2 matrix to fill with control points of subcurve for [0, z] (N is number of control points)
+   * \param right Nx2 matrix to fill with control points of subcurve for [z, 1]
+   */
+  void splitCurve(Scalar z, Eigen::Ref<MatrixX2> left, Eigen::Ref<MatrixX2> right) const;
+
+  /*!
+   * \brief Split the curve into multiple subcurves in a single sweep
+   * \param t_vector Parameters t at which to split the curve, in ascending order
+   * \return Polycurve with t_vector.size() + 1 subcurves (requires Bezier/polycurve.h)
+   */
+  PolyCurveT<Scalar> splitCurve(const std::vector<Scalar>& t_vector) const;
+
+  /*!
+   * \brief Get the part of the curve between two parameters
+   * \param t1 Parameter t at which the subcurve starts
+   * \param t2 Parameter t at which the subcurve ends (subcurve is reversed if t1 > t2)
+   * \return Subcurve for [t1, t2]
+   */
+  CurveT subCurve(Scalar t1, Scalar t2) const;
 
   /*!
    * \brief Get the points of intersection with another curve
@@ -246,7 +486,7 @@ public:
    * \param epsilon Precision of resulting intersection
    * \return A vector af points of intersection between curves
    */
-  PointVector pointsOfIntersection(const Curve& curve, bool stop_at_first = false, double epsilon = 0.001) const;
+  PointVector pointsOfIntersection(const CurveT& curve, bool stop_at_first = false, Scalar epsilon = 0.001) const;
 
   /*!
    * \brief Get the parameter t where curve is closest to given point
@@ -255,61 +495,214 @@ public:
    * \param epsilon Precision of resulting projection
    * \return Parameter t
    */
-  double projectPoint(const Point& point, double step = 0.01, double epsilon = 0.001, std::size_t max_iter = 15) const;
+  Scalar projectPoint(const Point& point, Scalar step = 0.01, Scalar epsilon = 0.001, std::size_t max_iter = 15) const;
 
   /*!
    * \brief applyContinuity Apply geometric continuity based on the another curve.
    * \param locked_curve Curve on which calculation are based.
    * \param beta_coeffs Beta-constraints used to calculate continuity. Size defines continuity order.
    */
-  void applyContinuity(const Curve& source_curve, std::vector<double>& beta_coeffs);
+  void applyContinuity(const CurveT& source_curve, std::vector<Scalar>& beta_coeffs);
 
 private:
   /*!
    * \brief Coefficients for matrix operations
    */
-  using Coeffs = Eigen::MatrixXd;
+  using Coeffs = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
   /*!
-   * \brief Map of different coefficient matrices, depending on the order of the curve
+   * \brief Array used for coefficient-wise operations
    */
-  using CoeffsMap = std::map<uint, Coeffs>;
+  using ArrayX = Eigen::Array<Scalar, Eigen::Dynamic, 1>;
+
+  /*!
+   * \brief Lazily generated value, published once through an atomic pointer
+   *
+   * Reading an already generated value never locks. If multiple threads generate
+   * the value at the same time, only one of them is published and others discard theirs.
+   * \warning Resetting is not thread-safe, it is only done from non-const member functions
+   */
+  template <typename T> class LazyCache
+  {
+  public:
+    LazyCache() : value_(nullptr) {}
+    LazyCache(const LazyCache&) = delete;
+    LazyCache& operator=(const LazyCache&) = delete;
+    ~LazyCache() { reset(); }
+
+    /// Get the value, generating it on first access
+    template <typename Generator> const T& get(Generator generate) const
+    {
+      const T* value = value_.load(std::memory_order_acquire);
+      if (!value)
+      {
+        std::unique_ptr<const T> new_value(new T(generate()));
+        if (value_.compare_exchange_strong(value, new_value.get(), std::memory_order_acq_rel,
+                                           std::memory_order_acquire))
+          value = new_value.release();
+      }
+      return *value;
+    }
+
+    /// Drop the generated value
+    void reset() { delete value_.exchange(nullptr, std::memory_order_acq_rel); }
+
+  private:
+    mutable std::atomic<const T*> value_;
+  };
+
+  /*!
+   * \brief Table of coefficient matrices, indexed directly by the order of the curve
+   *
+   * Matrices are generated on first access and never move afterwards,
+   * so references to them stay valid for the lifetime of the program.
+   * Each slot is a LazyCache, so reading an already generated matrix never
+   * locks. Indices beyond the size of the table fall back to a mutex guarded
+   * overflow storage.
+   * \tparam Size Number of lock-free slots
+   */
+  template <std::size_t Size> class CoeffsTable
+  {
+  public:
+    /// Get coefficients for index n, generating them on first access
+    template <typename Generator> const Coeffs& get(uint n, Generator generate);
+
+  private:
+    std::array<LazyCache<Coeffs>, Size> slots_;
+    std::vector<std::unique_ptr<const Coeffs>> overflow_;
+    std::mutex overflow_mutex_;
+  };
+
+  /*!
+   * \brief Cumulative arc length sampled on a uniform parameter grid
+   */
+  struct ArcLengthTable
+  {
+    VectorX t;     /*! Parameter at each sample */
+    VectorX s;     /*! Arc length from start at each sample */
+    VectorX speed; /*! Derivative of arc length (ds/dt) at each sample */
+    VectorX slope; /*! Derivative of parameter (dt/ds) at each sample, limited to keep inverse monotone */
+
+    /// Interpolate arc length for parameter t in [0, 1]
+    Scalar length(Scalar t) const;
+    /// Interpolate parameter for arc length s in [0, s.tail(1)]
+    Scalar parameter(Scalar s) const;
+  };
+
+  /// Roots (parameters and points) together with epsilon and max_iter used to find them
+  using RootsCache = std::pair<std::tuple<Scalar, std::size_t>, std::pair<std::vector<Scalar>, PointVector>>;
+  /// Parameters together with epsilon and max_iter used to find them
+  using ParametersCache = std::pair<std::tuple<Scalar, std::size_t>, std::vector<Scalar>>;
+  /// Polyline together with smoothness and precision used to generate it
+  using PolylineCache = std::pair<std::tuple<Scalar, Scalar>, PointVector>;
 
   /// Number of control points (order + 1)
   uint N_;
   /// N x 2 matrix where each row corresponds to control Point
-  Eigen::MatrixX2d control_points_;
-
-  // private caching
-  std::shared_ptr<const Curve> cached_derivative_; /*! If generated, stores derivative for later use */
-  std::unique_ptr<PointVector> cached_roots_;      /*! If generated, stores roots for later use */
-  std::tuple<double, double, std::size_t> cached_roots_params_{0, 0, 0}; /*! epsilon and max_iter of cached roots */
-  std::unique_ptr<BoundingBox>
+  MatrixX2 control_points_;
+  /// Method used for evaluating points and derivatives
+  Evaluator evaluator_;
+  /// Number of Legendre-Gauss quadrature nodes used for computing arc length
+  uint quadrature_nodes_;
+  /// Number of intervals in arc length table (0 if table is not used)
+  uint arc_length_intervals_;
+  /// Number of modifications of this curve, used by polycurves holding it to validate their cached data
+  std::size_t version_;
+  /// Modification counters of polycurves holding this curve, incremented with version_
+  std::vector<std::weak_ptr<std::atomic<std::size_t>>> owners_;
+  /// Mutex guarding owners_, as polycurves sharing this curve may be copied concurrently
+  std::mutex owners_mutex_;
+
+  // private caching, safe for concurrent readers
+  LazyCache<MatrixX2> cached_power_coeffs_;                    /*! If generated, stores power basis coefficients */
+  LazyCache<std::shared_ptr<const CurveT>> cached_derivative_; /*! If generated, stores derivative for later use */
+  LazyCache<BoundingBox>
       cached_bounding_box_tight_; /*! If generated, stores bounding box (use_roots = true) for later use */
-  std::unique_ptr<BoundingBox>
+  LazyCache<BoundingBox>
       cached_bounding_box_relaxed_; /*! If generated, stores bounding box (use_roots = false) for later use */
-  std::unique_ptr<PointVector> cached_polyline_;            /*! If generated, stores polyline for later use */
-  std::tuple<double, double> cached_polyline_params_{0, 0}; /*! Smootheness and precision of cached polyline */
+  LazyCache<ArcLengthTable> cached_arc_length_table_;          /*! If generated, stores table of arc length */
+  LazyCache<PointVector> cached_oriented_bounding_box_;        /*! If generated, stores oriented bounding box */
+  LazyCache<PointVector> cached_convex_hull_;                  /*! If generated, stores convex hull */
+  mutable std::shared_ptr<const RootsCache> cached_roots_; /*! If generated, stores roots (atomic access only) */
+  mutable std::shared_ptr<const ParametersCache>
+      cached_inflections_; /*! If generated, stores inflections (atomic access only) */
+  mutable std::shared_ptr<const ParametersCache>
+      cached_curvature_extrema_; /*! If generated, stores curvature extrema (atomic access only) */
+  mutable std::shared_ptr<const PolylineCache>
+      cached_polyline_; /*! If generated, stores polyline (atomic access only) */
 
   /// Reset all privately cached data
   inline void resetCache();
 
+  /// Mark the curve as modified, so polycurves holding it update their cached data
+  void markModified();
+
+  /// Register modification counter of a polycurve holding this curve
+  void addOwner(const std::shared_ptr<std::atomic<std::size_t>>& modifications);
+
+  /// Private getter function for coefficients of the curve in power basis
+  const MatrixX2& powerCoeffs() const;
+
+  /// Private getter function for table of arc length
+  const ArcLengthTable& arcLengthTable() const;
+
+  /// Private function for computing arc length with Legendre-Gauss quadrature
+  Scalar legendreGaussLength(Scalar t1, Scalar t2) const;
+
+  /// Private function for computing exact arc length of linear and quadratic curves, false if not applicable
+  bool closedFormLength(Scalar t1, Scalar t2, Scalar& length) const;
+
+  /// Private getter function for cached roots, finding them if not cached with same parameters
+  std::shared_ptr<const RootsCache> rootsCache(Scalar epsilon, std::size_t max_iter) const;
+
+  /// Private function for finding inflections (or curvature extrema if extrema is true)
+  std::vector<Scalar> curvatureRoots(bool extrema, Scalar epsilon, std::size_t max_iter) const;
+
+  /// Private function for computing bounding box of curve with given control points, without any caching
+  static BoundingBox computeBoundingBox(const MatrixX2& control_points, bool use_roots);
+
+  /// Private function for computing bounding boxes of a range of curves, without any caching
+  static void computeBoundingBoxes(const CurveT* curves, std::size_t count, BoundingBox* boxes, bool use_roots);
+
+  /// Private function for number of samples at equal arc length distances, keeping one at the end up to rounding
+  static uint sampleCount(Scalar length, Scalar spacing, Scalar offset = 0);
+
+  friend class PolyCurveT<Scalar>;
+  friend void boundingBoxes<>(const CurveT* curves, std::size_t count, BoundingBox* boxes, bool use_roots,
+                              uint threads);
+
   // static caching
-  static CoeffsMap bernstein_coeffs_;       /*! Map of Bernstein coefficients */
-  static CoeffsMap splitting_coeffs_left_;  /*! Map of coefficients to get subcurve for t = [0, 0.5] */
-  static CoeffsMap splitting_coeffs_right_; /*! Map of coefficients to get subcurve for t = [0.5, 1] */
-  static CoeffsMap elevate_order_coeffs_;   /*! Map of coefficients for elevating the order of curve */
-  static CoeffsMap lower_order_coeffs_;     /*! Map of coefficients for lowering the order of curve */
+  /// Number of Legendre-Gauss rules (LegendreGauss::max_N), each with its own slot in table of quadrature bases
+  static constexpr uint quadrature_rules_ = 64;
+  /// Number of hodograph sizes whose quadrature bases are read without locking, as for other tables
+  static constexpr uint quadrature_sizes_ = 64;
+  /// Lock-free slots for Bernstein bases of one hodograph size, indexed by node count
+  using QuadratureRow = std::vector<LazyCache<Coeffs>>;
+
+  static CoeffsTable<64> bernstein_coeffs_;       /*! Table of Bernstein coefficients */
+  static CoeffsTable<64> splitting_coeffs_left_;  /*! Table of coefficients to get subcurve for t = [0, 0.5] */
+  static CoeffsTable<64> splitting_coeffs_right_; /*! Table of coefficients to get subcurve for t = [0.5, 1] */
+  static CoeffsTable<64> elevate_order_coeffs_;   /*! Table of coefficients for elevating the order of curve */
+  static CoeffsTable<64> lower_order_coeffs_;     /*! Table of coefficients for lowering the order of curve */
+  static std::array<LazyCache<QuadratureRow>, quadrature_sizes_>
+      quadrature_basis_; /*! Bernstein bases at Legendre-Gauss nodes, a row per hodograph size generated on first use */
+  static CoeffsTable<0> quadrature_basis_overflow_; /*! Bernstein bases for larger hodographs */
 
   /// Private getter function for Bernstein coefficients
-  Coeffs bernsteinCoeffs() const;
-  /// Private getter function for coefficients to get a subcurve t = [0, z];
-  Coeffs splittingCoeffsLeft(double z = 0.5) const;
-  /// Private getter function for coefficients to get a subcurve t = [z, 1];
-  Coeffs splittingCoeffsRight(double z = 0.5) const;
+  const Coeffs& bernsteinCoeffs() const;
+  /// Private getter function for coefficients to get a subcurve t = [0, 0.5];
+  const Coeffs& splittingCoeffsLeft() const;
+  /// Private getter function for coefficients to get a subcurve t = [0.5, 1];
+  const Coeffs& splittingCoeffsRight() const;
+  /// Private function for computing coefficients to get a subcurve t = [0, z];
+  Coeffs splittingCoeffsLeft(Scalar z) const;
+  /// Private function for computing coefficients to get a subcurve t = [z, 1];
+  Coeffs splittingCoeffsRight(Scalar z) const;
   /// Private getter function for coefficients to elevate order of curve
-  Coeffs elevateOrderCoeffs(uint n) const;
+  const Coeffs& elevateOrderCoeffs(uint n) const;
   /// Private getter function for coefficients to lower order of curve
-  Coeffs lowerOrderCoeffs(uint n) const;
+  const Coeffs& lowerOrderCoeffs(uint n) const;
+  /// Private getter function for Bernstein basis of n control points at Legendre-Gauss nodes on [0, 1]
+  const Coeffs& quadratureBasis(uint n, uint nodes) const;
 };
 
 } // namespace Bezier
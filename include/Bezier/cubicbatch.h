@@ -0,0 +1,108 @@
+/*
+ * Copyright 2019 Mirko Kokot
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CUBICBATCH_H
+#define CUBICBATCH_H
+
+#include <array>
+
+#include "declarations.h"
+
+namespace Bezier
+{
+/*!
+ * \brief A batch of cubic Bezier curves
+ *
+ * A class for evaluating many cubic curves at a common parameter t.
+ * Control point coordinates are stored as a structure of arrays (one
+ * aligned array per control point and axis), so every operation is
+ * a handful of element-wise array expressions over the whole batch.
+ *
+ * \note Array expressions are vectorized by Eigen for the instruction set
+ * enabled at compile time (e.g. -mavx2 or -mavx512f), otherwise
+ * SSE2 or scalar code is used
+ */
+class CubicBatch
+{
+public:
+  /*!
+   * \brief Create an empty batch
+   */
+  CubicBatch() = default;
+
+  /*!
+   * \brief Create a batch from a vector of curves
+   * \param curves A vector of cubic curves
+   * \warning All curves have to be cubic
+   */
+  CubicBatch(const std::vector<Curve>& curves);
+
+  /*!
+   * \brief Get number of curves in the batch
+   * \return Number of curves
+   */
+  uint size() const;
+
+  /*!
+   * \brief Get a curve from the batch
+   * \param idx Index of curve
+   * \return A cubic curve
+   */
+  Curve curve(uint idx) const;
+
+  /*!
+   * \brief Get all curves from the batch
+   * \return A vector of cubic curves
+   */
+  std::vector<Curve> curves() const;
+
+  /*!
+   * \brief Replace a curve in the batch
+   * \param idx Index of curve
+   * \param curve A cubic curve
+   * \warning Curve has to be cubic
+   */
+  void setCurve(uint idx, const Curve& curve);
+
+  /*!
+   * \brief Get the points on all curves for a given t
+   * \param t Curve parameter
+   * \return Mx2 matrix where each row is a point on corresponding curve
+   */
+  Eigen::MatrixX2d valueAt(double t) const;
+
+  /*!
+   * \brief Get values of a derivative of all curves for a given t
+   * \param t Curve parameter
+   * \return Mx2 matrix where each row is a derivative of corresponding curve
+   */
+  Eigen::MatrixX2d derivativeAt(double t) const;
+
+  /*!
+   * \brief Get curvature of all curves for a given t
+   * \param t Curve parameter
+   * \return A vector of curvatures of corresponding curves
+   */
+  Eigen::VectorXd curvatureAt(double t) const;
+
+private:
+  /// Coordinates of each of 4 control points, one array per control point
+  std::array<Eigen::ArrayXd, 4> x_, y_;
+};
+
+} // namespace Bezier
+
+#endif // CUBICBATCH_H
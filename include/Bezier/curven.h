@@ -0,0 +1,438 @@
+/*
+ * Copyright 2019 Mirko Kokot
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CURVEN_H
+#define CURVEN_H
+
+#include <algorithm>
+#include <array>
+
+#include "bernstein_roots.h"
+#include "bezier.h"
+#include "legendre_gauss.h"
+
+namespace Bezier
+{
+/*!
+ * \brief A fixed-order Bezier curve class
+ *
+ * A class for storing and using Bezier curve whose order is known at compile time.
+ * Control points and coefficient matrices are fixed-size, so there are no heap
+ * allocations and the compiler can unroll the evaluation.
+ *
+ * \tparam Order Order of curve (Nth order curve is described with N+1 points)
+ * \warning Use Eigen::aligned_allocator when storing curves in STL containers
+ */
+template <uint Order> class CurveN
+{
+public:
+  /// Number of control points (order + 1)
+  static constexpr uint N = Order + 1;
+  /// N x 2 matrix where each row corresponds to control Point
+  using ControlPoints = Eigen::Matrix<double, N, 2>;
+  /// Type of the derivative curve (hodograph)
+  using Derivative = CurveN<(Order > 0 ? Order - 1 : 0)>;
+
+  /*!
+   * \brief Create the Bezier curve
+   * \param points Nx2 matrix where each row is one of N control points that define the curve
+   */
+  CurveN(const ControlPoints& points);
+
+  /*!
+   * \brief Create the Bezier curve
+   * \param points A vector of control points that define the curve
+   * \warning Number of points has to be Order + 1
+   */
+  CurveN(const PointVector& points);
+
+  /*!
+   * \brief Create the Bezier curve from a dynamic curve of the same order
+   * \param curve A Bezier curve to copy
+   * \warning Order of curve has to be Order
+   */
+  explicit CurveN(const Curve& curve);
+
+  /*!
+   * \brief Convert to dynamic Bezier curve
+   */
+  operator Curve() const;
+
+  /*!
+   * \brief Get order of curve (Nth order curve is described with N+1 points);
+   * \return Order of curve
+   */
+  uint order() const;
+
+  /*!
+   * \brief Get the control points
+   * \return A vector of control points
+   */
+  PointVector controlPoints() const;
+
+  /*!
+   * \brief Get first and last control points
+   * \return A pair of end points
+   */
+  std::pair<Point, Point> endPoints() const;
+
+  /*!
+   * \brief Compute exaxt arc length with Legendre-Gauss quadrature
+   * \return Arc length
+   * \warning Precision depends on value of LEGENDRE_GAUSS_N when library is built, same as for Curve
+   */
+  double length() const;
+
+  /*!
+   * \brief Compute exact arc length with Legendre-Gauss quadrature
+   * \param t Curve parameter to which length is computed
+   * \return Arc length from start to parameter t
+   * \warning Precision depends on value of LEGENDRE_GAUSS_N when library is built, same as for Curve
+   */
+  double length(double t) const;
+
+  /*!
+   * \brief Compute exact arc length with Legendre-Gauss quadrature
+   * \param t1 Curve parameter from which length is computed
+   * \param t2 Curve parameter to which length is computed
+   * \return Arc length between paramaters t1 and t2
+   * \warning Precision depends on value of LEGENDRE_GAUSS_N when library is built, same as for Curve
+   */
+  double length(double t1, double t2) const;
+
+  /*!
+   * \brief Reverse order of control points
+   */
+  void reverse();
+
+  /*!
+   * \brief Set the new coordinates to a control point
+   * \param index Index of chosen control point
+   * \param point New control point
+   */
+  void manipulateControlPoint(uint idx, const Point& point);
+
+  /*!
+   * \brief Get the point on curve for a given t
+   * \param t Curve parameter
+   * \return Point on a curve for a given t
+   */
+  Point valueAt(double t) const;
+
+  /*!
+   * \brief Get curvature of curve for a given t
+   * \param t Curve parameter
+   * \return Curvature of a curve for a given t
+   */
+  double curvatureAt(double t) const;
+
+  /*!
+   * \brief Get the tangent of curve for a given t
+   * \param t Curve parameter
+   * \param normalize If the resulting tangent should be normalized
+   * \return Tangent of a curve for a given t
+   */
+  Vector tangentAt(double t, bool normalize = true) const;
+
+  /*!
+   * \brief Get the normal of curve for a given t
+   * \param t Curve parameter
+   * \param normalize If the resulting normal should be normalized
+   * \return Normal of a curve for given t
+   */
+  Vector normalAt(double t, bool normalize = true) const;
+
+  /*!
+   * \brief Get the derivative of a curve
+   * \return Derivative curve
+   */
+  Derivative derivative() const;
+
+  /*!
+   * \brief Get value of a derivative for a given t
+   * \param t Curve parameter
+   * \return Derivative curve
+   */
+  Point derivativeAt(double t) const;
+
+  /*!
+   * \brief Get value of an nth derivative for a given t
+   * \param n Desired number of derivative
+   * \param t Curve parameter
+   * \return Derivative curve
+   */
+  Point derivativeAt(uint n, double t) const;
+
+  /*!
+   * \brief Get the roots of curve on both axis
+   * \return A vector of extreme points
+   */
+  PointVector roots() const;
+
+  /*!
+   * \brief Get the bounding box of curve
+   * \param use_roots If algorithm should use roots
+   * \return Bounding box (if use_roots is false, returns the bounding box of control points)
+   */
+  BoundingBox boundingBox(bool use_roots = true) const;
+
+  /*!
+   * \brief Split the curve into two subcurves
+   * \param z Parameter t at which to split the curve
+   * \return Pair of two subcurves
+   */
+  std::pair<CurveN, CurveN> splitCurve(double z = 0.5) const;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+private:
+  template <uint> friend class CurveN;
+
+  /*!
+   * \brief Coefficients for matrix operations
+   */
+  using Coeffs = Eigen::Matrix<double, N, N>;
+
+  /// N x 2 matrix where each row corresponds to control Point
+  ControlPoints control_points_;
+
+  /// Static getter function for Bernstein coefficients
+  static const Coeffs& bernsteinCoeffs();
+
+  /// Maximal number of roots of derivative on both axes
+  static constexpr uint max_roots = Order > 1 ? 2 * (Order - 1) : 1;
+
+  /*!
+   * \brief Get parameters of roots of derivative on both axes, without heap allocations
+   * \param roots Array to store parameters of roots
+   * \return Number of roots found
+   */
+  uint rootParameters(std::array<double, max_roots>& roots) const;
+};
+
+template <uint Order> CurveN<Order>::CurveN(const ControlPoints& points) : control_points_(points) {}
+
+template <uint Order> CurveN<Order>::CurveN(const PointVector& points)
+{
+  if (points.size() != N)
+    throw std::invalid_argument{"Number of points does not match the order of curve."};
+  for (uint k = 0; k < N; k++)
+    control_points_.row(k) = points[k];
+}
+
+template <uint Order> CurveN<Order>::CurveN(const Curve& curve) : CurveN(curve.controlPoints()) {}
+
+template <uint Order> CurveN<Order>::operator Curve() const { return Curve(Eigen::MatrixX2d(control_points_)); }
+
+template <uint Order> uint CurveN<Order>::order() const { return Order; }
+
+template <uint Order> PointVector CurveN<Order>::controlPoints() const
+{
+  PointVector points(N);
+  for (uint k = 0; k < N; k++)
+    points[k] = control_points_.row(k);
+  return points;
+}
+
+template <uint Order> std::pair<Point, Point> CurveN<Order>::endPoints() const
+{
+  return std::make_pair(control_points_.row(0), control_points_.row(N - 1));
+}
+
+template <uint Order> double CurveN<Order>::length() const { return length(0.0, 1.0); }
+
+template <uint Order> double CurveN<Order>::length(double t) const { return length(0.0, t); }
+
+template <uint Order> double CurveN<Order>::length(double t1, double t2) const
+{
+  // same quadrature as for Curve, as header default of LEGENDRE_GAUSS_N may differ from the one library is built with
+  static const LegendreGauss::Rule& rule = LegendreGauss::rule(Curve::defaultQuadratureNodes());
+  const Derivative hodograph = derivative();
+  double sum = 0;
+
+  for (uint k = 0; k < rule.n; k++)
+    sum += rule.weights[k] * hodograph.valueAt(rule.abcissae[k] * (t2 - t1) / 2 + (t1 + t2) / 2).norm();
+
+  return sum * (t2 - t1) / 2;
+}
+
+template <uint Order> void CurveN<Order>::reverse() { control_points_ = control_points_.colwise().reverse().eval(); }
+
+template <uint Order> void CurveN<Order>::manipulateControlPoint(uint idx, const Point& point)
+{
+  control_points_.row(idx) = point;
+}
+
+template <uint Order> Point CurveN<Order>::valueAt(double t) const
+{
+  Eigen::Matrix<double, 1, N> power_basis;
+  power_basis(0) = 1;
+  for (uint k = 1; k < N; k++)
+    power_basis(k) = power_basis(k - 1) * t;
+  return (power_basis * bernsteinCoeffs() * control_points_).transpose();
+}
+
+template <uint Order> double CurveN<Order>::curvatureAt(double t) const
+{
+  Point d1 = derivativeAt(t);
+  Point d2 = derivativeAt(2, t);
+
+  return (d1.x() * d2.y() - d1.y() * d2.x()) / std::pow(d1.norm(), 3);
+}
+
+template <uint Order> Vector CurveN<Order>::tangentAt(double t, bool normalize) const
+{
+  Point p(derivativeAt(t));
+  if (normalize && p.norm() > 0)
+    p.normalize();
+  return p;
+}
+
+template <uint Order> Vector CurveN<Order>::normalAt(double t, bool normalize) const
+{
+  Point tangent = tangentAt(t, normalize);
+  return {-tangent.y(), tangent.x()};
+}
+
+template <uint Order> typename CurveN<Order>::Derivative CurveN<Order>::derivative() const
+{
+  return Derivative(
+      (Order * (control_points_.template bottomRows<Order>() - control_points_.template topRows<Order>())).eval());
+}
+
+template <> inline CurveN<0>::Derivative CurveN<0>::derivative() const
+{
+  return Derivative(Derivative::ControlPoints::Zero());
+}
+
+template <uint Order> Point CurveN<Order>::derivativeAt(double t) const { return derivative().valueAt(t); }
+
+template <uint Order> Point CurveN<Order>::derivativeAt(uint n, double t) const
+{
+  if (n >= N)
+    return Point::Zero();
+
+  // nth hodograph is kept in the first N - n rows
+  ControlPoints points = control_points_;
+  for (uint size = N; size > N - n; size--)
+    for (uint k = 0; k + 1 < size; k++)
+      points.row(k) = (size - 1) * (points.row(k + 1) - points.row(k));
+
+  // de Casteljau
+  for (uint size = N - n; size > 1; size--)
+    for (uint k = 0; k + 1 < size; k++)
+      points.row(k) = (1 - t) * points.row(k) + t * points.row(k + 1);
+
+  return points.row(0).transpose();
+}
+
+template <uint Order> PointVector CurveN<Order>::roots() const
+{
+  std::array<double, max_roots> roots_t;
+  const uint count = rootParameters(roots_t);
+
+  PointVector roots;
+  roots.reserve(count);
+  for (uint k = 0; k < count; k++)
+    roots.push_back(valueAt(roots_t[k]));
+  return roots;
+}
+
+template <uint Order> BoundingBox CurveN<Order>::boundingBox(bool use_roots) const
+{
+  BoundingBox bbox;
+  if (use_roots)
+  {
+    bbox.extend(Point(control_points_.row(0)));
+    bbox.extend(Point(control_points_.row(N - 1)));
+    std::array<double, max_roots> roots_t;
+    const uint count = rootParameters(roots_t);
+    for (uint k = 0; k < count; k++)
+      bbox.extend(valueAt(roots_t[k]));
+  }
+  else
+  {
+    for (uint k = 0; k < N; k++)
+      bbox.extend(Point(control_points_.row(k)));
+  }
+  return bbox;
+}
+
+template <uint Order> uint CurveN<Order>::rootParameters(std::array<double, max_roots>& roots) const
+{
+  uint count = 0;
+  // lines have no extremes
+  if (Order < 2)
+    return count;
+
+  // check both axes, on Bernstein coefficients of derivative (scaled by 1 / Order)
+  for (uint k = 0; k < 2; k++)
+  {
+    std::array<double, (Order > 0 ? Order : 1)> coeffs;
+    for (uint i = 0; i < Order; i++)
+      coeffs[i] = control_points_(i + 1, k) - control_points_(i, k);
+    // constant coordinate has no extremes
+    if (std::all_of(coeffs.begin(), coeffs.begin() + Order, [](double c) { return c == 0; }))
+      continue;
+
+    // keep interior roots, a root may be appended twice on the border of subdivided intervals
+    const uint first = count;
+    bernsteinRoots(coeffs, Order, 0.0, 1.0, 1e-12, 100, [&roots, &count, first](double t) {
+      if (count < roots.size() && (count == first || std::fabs(t - roots[count - 1]) > 1e-12))
+        roots[count++] = t;
+    });
+  }
+  return count;
+}
+
+template <uint Order> std::pair<CurveN<Order>, CurveN<Order>> CurveN<Order>::splitCurve(double z) const
+{
+  // de Casteljau - left subcurve is built from the first, and right from the last points of each level
+  ControlPoints left, right, points = control_points_;
+  for (uint size = N; size > 0; size--)
+  {
+    left.row(N - size) = points.row(0);
+    right.row(size - 1) = points.row(size - 1);
+    for (uint k = 0; k + 1 < size; k++)
+      points.row(k) = (1 - z) * points.row(k) + z * points.row(k + 1);
+  }
+  return std::make_pair(CurveN(left), CurveN(right));
+}
+
+template <uint Order> const typename CurveN<Order>::Coeffs& CurveN<Order>::bernsteinCoeffs()
+{
+  static const Coeffs coeffs = [] {
+    // binomial coefficients
+    Coeffs pascal(Coeffs::Zero());
+    for (uint k = 0; k < N; k++)
+    {
+      pascal(k, 0) = 1;
+      for (uint i = 1; i <= k; i++)
+        pascal(k, i) = pascal(k - 1, i - 1) + (i < k ? pascal(k - 1, i) : 0);
+    }
+
+    Coeffs bernstein(Coeffs::Zero());
+    for (uint k = 0; k < N; k++)
+      for (uint i = 0; i <= k; i++)
+        bernstein(k, i) = ((k - i) % 2 ? -1 : 1) * pascal(N - 1, k) * pascal(k, i);
+    return bernstein;
+  }();
+  return coeffs;
+}
+
+} // namespace Bezier
+
+#endif // CURVEN_H
@@ -33,8 +33,27 @@ namespace Bezier
  * It uses private and static caching for storing often accessed data.
  * Private caching is used for data concerning individual curve, while
  * static caching is used for common data (coefficient matrices)
+ *
+ * \tparam Scalar Floating point type of coordinates and parameters
+ */
+template <typename Scalar> class CurveT;
+
+/*!
+ * \brief A fixed-order Bezier curve class
+ *
+ * A class for storing and using Bezier curve whose order is
+ * known at compile time. Control points and coefficients are
+ * stored in fixed-size matrices, avoiding heap allocations.
  */
-class Curve;
+template <uint Order> class CurveN;
+
+/*!
+ * \brief A batch of cubic Bezier curves
+ *
+ * A class for evaluating many cubic curves at a common
+ * parameter, with control points stored as a structure of arrays.
+ */
+class CubicBatch;
 
 /*!
  * \brief A polyline class
@@ -51,24 +70,85 @@ class PolyLine;
  * A class for linking multiple Bezier curves with at least
  * C0 continuity. It allows subcurve and continuity manipulation.
  * Both parametric and geometric continuity are supported.
+ *
+ * \tparam Scalar Floating point type of coordinates and parameters
+ */
+template <typename Scalar> class PolyCurveT;
+
+/*!
+ * \brief Method used for evaluating points and derivatives of a curve
+ */
+enum class Evaluator
+{
+  PowerBasis, ///< Horner's method on cached power basis coefficients (fast, loses precision for high orders)
+  DeCasteljau ///< De Casteljau's algorithm on control points (numerically stable for any order)
+};
+
+/*!
+ * \brief Bezier curve in double precision
+ */
+using Curve = CurveT<double>;
+/*!
+ * \brief Bezier curve in single precision
+ */
+using Curvef = CurveT<float>;
+/*!
+ * \brief Bezier polycurve in double precision
+ */
+using PolyCurve = PolyCurveT<double>;
+/*!
+ * \brief Bezier polycurve in single precision
+ */
+using PolyCurvef = PolyCurveT<float>;
+
+/*!
+ * \brief Point in xy plane
+ */
+template <typename Scalar> using PointT = Eigen::Matrix<Scalar, 2, 1>;
+/*!
+ * \brief A Vector in xy plane
  */
-class PolyCurve;
+template <typename Scalar> using VectorT = Eigen::Matrix<Scalar, 2, 1>;
+/*!
+ * \brief A vector of Points
+ */
+template <typename Scalar> using PointVectorT = std::vector<PointT<Scalar>>;
+/*!
+ * \brief Bounding box class
+ */
+template <typename Scalar> using BoundingBoxT = Eigen::AlignedBox<Scalar, 2>;
 
 /*!
  * \brief Point in xy plane
  */
-using Point = Eigen::Vector2d;
+using Point = PointT<double>;
 /*!
  * \brief A Vector in xy plane
  */
-using Vector = Eigen::Vector2d;
+using Vector = VectorT<double>;
 /*!
  * \brief A vector of Points
  */
-using PointVector = std::vector<Point>;
+using PointVector = PointVectorT<double>;
 /*!
  * \brief Bounding box class
  */
-using BoundingBox = Eigen::AlignedBox2d;
+using BoundingBox = BoundingBoxT<double>;
+
+/*!
+ * \brief Get the bounding boxes of many curves at once
+ *
+ * Boxes are computed directly from control points (with analytic extremes
+ * up to order 4), without reading or filling caches of the curves. Curves
+ * are split into contiguous chunks, each processed by its own thread.
+ * \param curves Pointer to the first of count curves
+ * \param count Number of curves
+ * \param boxes Pointer to preallocated output with room for count bounding boxes
+ * \param use_roots If algorithm should use roots (otherwise bounding boxes of control points)
+ * \param threads Number of threads (0 for hardware concurrency), small batches use fewer
+ */
+template <typename Scalar>
+void boundingBoxes(const CurveT<Scalar>* curves, std::size_t count, BoundingBoxT<Scalar>* boxes, bool use_roots = true,
+                   uint threads = 0);
 }
 #endif // DECLARATIONS_H
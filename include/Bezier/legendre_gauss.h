@@ -13,46 +13,38 @@
 #endif // LEGENDRE_GAUSS_N
 
 #include <array>
+#include <stdexcept>
 
 namespace LegendreGauss {
 
-constexpr int N = LEGENDRE_GAUSS_N;
-
-#if LEGENDRE_GAUSS_N == 1
-constexpr std::array<double, 1> abcissae {
+constexpr std::array<double, 1> abcissae_1 {
   0};
-#elif LEGENDRE_GAUSS_N == 2
-constexpr std::array<double, 2> abcissae {
+constexpr std::array<double, 2> abcissae_2 {
   -0.5773502691896257645091487805019574556476017512701268760186023264839776723029333456937153955857495252252087138051355676766566483649996508262705518373647912161760310773007685273559916067003615583077550051041144223011076288835574182229739459904090157105534559538626730166621791266197964892168,
   0.5773502691896257645091487805019574556476017512701268760186023264839776723029333456937153955857495252252087138051355676766566483649996508262705518373647912161760310773007685273559916067003615583077550051041144223011076288835574182229739459904090157105534559538626730166621791266197964892168};
-#elif LEGENDRE_GAUSS_N == 3
-constexpr std::array<double, 3> abcissae {
+constexpr std::array<double, 3> abcissae_3 {
    0,
   -0.774596669241483377035853079956479922166584341058318165317514753222696618387395806703857475371734703583260441372189929402637908087832729923135978349224240702213750958202698716256783906245777858513169283405612501838634682531972963691092925710263188052523534528101729260090115562126394576188,
   0.774596669241483377035853079956479922166584341058318165317514753222696618387395806703857475371734703583260441372189929402637908087832729923135978349224240702213750958202698716256783906245777858513169283405612501838634682531972963691092925710263188052523534528101729260090115562126394576188};
-#elif LEGENDRE_GAUSS_N == 4
-constexpr std::array<double, 4> abcissae {
+constexpr std::array<double, 4> abcissae_4 {
   -0.3399810435848562648026657591032446872005758697709143525929539768210200304632370344778752804355548115489602395207464932135845003241712491992776363684338328221538611182352836311104158340621521124125023821932864240034767086752629560943410821534146791671405442668508151756169732898924953195536,
   0.3399810435848562648026657591032446872005758697709143525929539768210200304632370344778752804355548115489602395207464932135845003241712491992776363684338328221538611182352836311104158340621521124125023821932864240034767086752629560943410821534146791671405442668508151756169732898924953195536,
   -0.8611363115940525752239464888928095050957253796297176376157219209065294714950488657041623398844793052105769209319781763249637438391157919764084938458618855762872931327441369944290122598469710261906458681564745219362114916066097678053187180580268539141223471780870198639372247416951073770551,
   0.8611363115940525752239464888928095050957253796297176376157219209065294714950488657041623398844793052105769209319781763249637438391157919764084938458618855762872931327441369944290122598469710261906458681564745219362114916066097678053187180580268539141223471780870198639372247416951073770551};
-#elif LEGENDRE_GAUSS_N == 5
-constexpr std::array<double, 5> abcissae {
+constexpr std::array<double, 5> abcissae_5 {
   0,
   -0.5384693101056830910363144207002088049672866069055599562022316270594711853677552910358036672505709315713670572321043495510816912158744046420683486075627481533978123828583369317846132387526796166796502053799563629878671716361660767584852200097418079241406256057571019602720019270523093750336,
   0.5384693101056830910363144207002088049672866069055599562022316270594711853677552910358036672505709315713670572321043495510816912158744046420683486075627481533978123828583369317846132387526796166796502053799563629878671716361660767584852200097418079241406256057571019602720019270523093750336,
   -0.9061798459386639927976268782993929651256519107625308628737622865437707949166868469411429895535422619115836248167051160932020660084349721915374869570125418659061700540273012086530604091207821562942704193786707298217315368769002376029537907738935528847397895557648103916797868140600953498906,
   0.9061798459386639927976268782993929651256519107625308628737622865437707949166868469411429895535422619115836248167051160932020660084349721915374869570125418659061700540273012086530604091207821562942704193786707298217315368769002376029537907738935528847397895557648103916797868140600953498906};
-#elif LEGENDRE_GAUSS_N == 6
-constexpr std::array<double, 6> abcissae {
+constexpr std::array<double, 6> abcissae_6 {
   0.6612093864662645136613995950199053470064485643951700708145267058521834966071431009442864037464614564298883716392751466795573467722253804381723198010093367423918538864300079016299442625145884902455718821970386303223620117352321357022187936189069743012315558710642131016398967690135661651261150514997832,
   -0.6612093864662645136613995950199053470064485643951700708145267058521834966071431009442864037464614564298883716392751466795573467722253804381723198010093367423918538864300079016299442625145884902455718821970386303223620117352321357022187936189069743012315558710642131016398967690135661651261150514997832,
   -0.2386191860831969086305017216807119354186106301400213501813951645742749342756398422492244272573491316090722230970106872029554530350772051352628872175189982985139866216812636229030578298770859440976999298617585739469216136216592222334626416400139367778945327871453246721518889993399000945408150514997832,
   0.2386191860831969086305017216807119354186106301400213501813951645742749342756398422492244272573491316090722230970106872029554530350772051352628872175189982985139866216812636229030578298770859440976999298617585739469216136216592222334626416400139367778945327871453246721518889993399000945406150514997832,
   -0.9324695142031520278123015544939946091347657377122898248725496165266135008442001962762887399219259850478636797265728341065879713795116384041921786180750210169211578452038930846310372961174632524612619760497437974074226320896716211721783852305051047442772222093863676553669179038880252326771150514997832,
   0.9324695142031520278123015544939946091347657377122898248725496165266135008442001962762887399219259850478636797265728341065879713795116384041921786180750210169211578452038930846310372961174632524612619760497437974074226320896716211721783852305051047442772222093863676553669179038880252326771150514997832};
-#elif LEGENDRE_GAUSS_N == 7
-constexpr std::array<double, 7> abcissae {
+constexpr std::array<double, 7> abcissae_7 {
   0,
   0.4058451513773971669066064120769614633473820140993701263870432517946638132261256553283126897277465877652867586660480186780142389774087899602458293459431152403705864850136028192946798646997494188869169765542654505357384603100658598476270710450994883480024599267113885472679490162043321422574150514997832,
   -0.4058451513773971669066064120769614633473820140993701263870432517946638132261256553283126897277465877652867586660480186780142389774087899602458293459431152403705864850136028192946798646997494188869169765542654505357384603100658598476270710450994883480024599267113885472679490162043321422574150514997832,
@@ -60,8 +52,7 @@ constexpr std::array<double, 7> abcissae {
   0.7415311855993944398638647732807884070741476471413902601199553519674298746721805137928268323668632470596925180931120142436000543982298353471703857152740498332960747607976107150698769026932844561958151246095962171815950287169821619140709720118875391555834601955414971467103462901278094572093150514997832,
   -0.949107912342758524526189684047851262400770937670617783548769103913063330354840140805730770027925724144300739666995216194195625811353553118277789915859810085013901000179888247732305040104815148851112904940437420579459979108498442397952261081440138823188704950068274774322776063669713039873415051499783203,
   0.949107912342758524526189684047851262400770937670617783548769103913063330354840140805730770027925724144300739666995216194195625811353553118277789915859810085013901000179888247732305040104815148851112904940437420579459979108498442397952261081440138823188704950068274774322776063669713039873415051499783203};
-#elif LEGENDRE_GAUSS_N == 8
-constexpr std::array<double, 8> abcissae {
+constexpr std::array<double, 8> abcissae_8 {
   -0.1834346424956498049394761423601839806667578129129737823171884736992044742215421141160682237111233537452676587642867666089196012523876865683788569995160663568104475551617138501966385810764205532370882654749492812314961247764619363562770645716456613159405134052985058171969174306064445289638150514997832,
   0.1834346424956498049394761423601839806667578129129737823171884736992044742215421141160682237111233537452676587642867666089196012523876865683788569995160663568104475551617138501966385810764205532370882654749492812314961247764619363562770645716456613159405134052985058171969174306064445289638150514997832,
   -0.5255324099163289858177390491892463490419642431203928577508570992724548207685612725239614001936319820619096829248252608507108793766638779939805395303668253631119018273032402360060717470006127901479587576756241288895336619643528330825624263470540184224603688817537938539658502113876953598879150514997832,
@@ -70,8 +61,7 @@ constexpr std::array<double, 8> abcissae {
   0.7966664774136267395915539364758304368371717316159648320701702950392173056764730921471519272957259390191974534530973092653656494917010859602772562074621689676153935016290342325645582634205301545856060095727342603557415761265140428851957341933710803722783136113628137267630651413319993338002150514997832,
   -0.960289856497536231683560868569472990428235234301452038271639777372424897743419284439438959263312268310424392817294176210238958155217128547937364220490969970043398261832663734680878126355334692786735966348087059754254760392931853386656813286884261347489628923208763998895240977248938732425615051499783203,
   0.960289856497536231683560868569472990428235234301452038271639777372424897743419284439438959263312268310424392817294176210238958155217128547937364220490969970043398261832663734680878126355334692786735966348087059754254760392931853386656813286884261347489628923208763998895240977248938732425615051499783203};
-#elif LEGENDRE_GAUSS_N == 9
-constexpr std::array<double, 9> abcissae {
+constexpr std::array<double, 9> abcissae_9 {
   0,
   -0.8360311073266357942994297880697348765441067181246759961043719796394550068815901188939461970258575402563758103910561868767921700399852813493611963795348388298072683628655858714286307690921827503279179493378017903390282931287792638170061442346288416366768259295268522725491437592698775616386150514997832,
   0.8360311073266357942994297880697348765441067181246759961043719796394550068815901188939461970258575402563758103910561868767921700399852813493611963795348388298072683628655858714286307690921827503279179493378017903390282931287792638170061442346288416366768259295268522725491437592698775616386150514997832,
@@ -81,8 +71,7 @@ constexpr std::array<double, 9> abcissae {
   0.3242534234038089290385380146433366085719562607369730888270474768421865795351242491930986016984975672077778257173507373911718045575238432394572865005705333805025491599132630235053630398924931286361909328940173345187813296193687231694926973637651870715469270935223550274475117654585286698075150514997832,
   -0.6133714327005903973087020393414741847857206049405646928728129422812673464910011985832400139035685845782334895968597685619397117528519746872458346040371559996202334828312987463516926466812888532978280620182027590531371274017229787367921934803381534015176954113597402763904697814697273286917150514997832,
   0.6133714327005903973087020393414741847857206049405646928728129422812673464910011985832400139035685845782334895968597685619397117528519746872458346040371559996202334828312987463516926466812888532978280620182027590531371274017229787367921934803381534015176954113597402763904697814697273286917150514997832};
-#elif LEGENDRE_GAUSS_N == 10
-constexpr std::array<double, 10> abcissae {
+constexpr std::array<double, 10> abcissae_10 {
   -0.1488743389816312108848260011297199846175648594206916957079892535159036173556685213711776297994636912300311608052553388261028901818643765402316761969968090913050737827720371059070942475859422743249837177174247346216914852902942929003193466659082433838094355075996833570230005003837280634351,
   0.1488743389816312108848260011297199846175648594206916957079892535159036173556685213711776297994636912300311608052553388261028901818643765402316761969968090913050737827720371059070942475859422743249837177174247346216914852902942929003193466659082433838094355075996833570230005003837280634351,
   -0.4333953941292471907992659431657841622000718376562464965027015131437669890777035012251027579501177212236829350409989379472742247577232492051267741032822086200952319270933462032011328320387691584063411149801129823141488787443204324766414421576788807708483879452488118549797039287926964254222,
@@ -93,8 +82,7 @@ constexpr std::array<double, 10> abcissae {
   0.8650633666889845107320966884234930485275430149653304525219597318453747551380555613567907289460457706944046310864117651686783001614934535637392729396890950011571349689893051612072435760480900979725923317923795535739290595879776956832427702236942765911483643714816923781701572597289139322313,
   -0.9739065285171717200779640120844520534282699466923821192312120666965952032346361596257235649562685562582330425187742112150221686014344777799205409587259942436704413695764881258799146633143510758737119877875210567067452435368713683033860909388311646653581707125686970668737259229449284383797,
   0.9739065285171717200779640120844520534282699466923821192312120666965952032346361596257235649562685562582330425187742112150221686014344777799205409587259942436704413695764881258799146633143510758737119877875210567067452435368713683033860909388311646653581707125686970668737259229449284383797};
-#elif LEGENDRE_GAUSS_N == 11
-constexpr std::array<double, 11> abcissae {
+constexpr std::array<double, 11> abcissae_11 {
   0,
   -0.2695431559523449723315319854008615246796218624390522816239256318800570662236947357038215922442673013244372186707844201317032610313861598694458740089972098147110859664229110703810548417611253598433629104961304364919694348869220454420381458348829492059599272547136809488213590022808799544432,
   0.2695431559523449723315319854008615246796218624390522816239256318800570662236947357038215922442673013244372186707844201317032610313861598694458740089972098147110859664229110703810548417611253598433629104961304364919694348869220454420381458348829492059599272547136809488213590022808799544432,
@@ -106,8 +94,7 @@ constexpr std::array<double, 11> abcissae {
   0.8870625997680952990751577693039272666316757512253143849674110555376113138573726674422905951265973741582555646951327940013076695594509798185810180896230599904165467596733228383545894580728599866619872123685840446904096192035118026087613351419345822803475375072199421279490583145056511656277,
   -0.978228658146056992803938001122857390771422408919784415425801065983663799380889988200319398167344769899347932998927873161596618173502598141217454669626015380226646741759135834253706737232732796978240624149905454601562181445875868720775160095398398080194649946120067899312755269024073737418,
   0.978228658146056992803938001122857390771422408919784415425801065983663799380889988200319398167344769899347932998927873161596618173502598141217454669626015380226646741759135834253706737232732796978240624149905454601562181445875868720775160095398398080194649946120067899312755269024073737418};
-#elif LEGENDRE_GAUSS_N == 12
-constexpr std::array<double, 12> abcissae {
+constexpr std::array<double, 12> abcissae_12 {
   -0.125233408511468915472441369463853129983396916305444273212921754748462056241389688742868298469491359594104598791320510973151599696644634079597205789302813634271497518773646107977862904010858517498034581635360090619153385339857922243809504545097342064247739686883799517760948964137522919201,
   0.125233408511468915472441369463853129983396916305444273212921754748462056241389688742868298469491359594104598791320510973151599696644634079597205789302813634271497518773646107977862904010858517498034581635360090619153385339857922243809504545097342064247739686883799517760948964137522919201,
   -0.3678314989981801937526915366437175612563601413354096213117998795040899295167878738787344285005465772346331263959771452151351521793274393532419916377427538287132038966416227430371828447096318893454788484182261146122752697960937162960050463962319787423676668046033025242558536362617894366679,
@@ -120,8 +107,7 @@ constexpr std::array<double, 12> abcissae {
   0.9041172563704748566784658661190961925375967092132975465540757606812347957292357904869694278237332678118603828964104223488997198195429960106352490125826829199834735444861420614089910024700968257625822169344644869874616758075784239807438092064065954540171679180850205196702894963912359448494,
   -0.981560634246719250690549090149280822960155199813731510462682121807793244318253982225257267890452235785556492372841273185245457030447077167082769674887528861125655501844826629100412021372015399969612358827884663023371873515839205303744147639383170419389543470920618543180673569225988370568,
   0.981560634246719250690549090149280822960155199813731510462682121807793244318253982225257267890452235785556492372841273185245457030447077167082769674887528861125655501844826629100412021372015399969612358827884663023371873515839205303744147639383170419389543470920618543180673569225988370568};
-#elif LEGENDRE_GAUSS_N == 13
-constexpr std::array<double, 13> abcissae {
+constexpr std::array<double, 13> abcissae_13 {
   0,
   -0.2304583159551347940655281210979888352115423758835311634692614978371620836885819508128029447646801293238512802493163412495640890375153405001503784765828756320940609583773703635107856626040295675333153435572182437721389578601864974297041861246826819085793735507197123622937060192780190134049,
   0.2304583159551347940655281210979888352115423758835311634692614978371620836885819508128029447646801293238512802493163412495640890375153405001503784765828756320940609583773703635107856626040295675333153435572182437721389578601864974297041861246826819085793735507197123622937060192780190134049,
@@ -135,8 +121,7 @@ constexpr std::array<double, 13> abcissae {
   0.917598399222977965206547836500719512390474790111683295895285345659659208589609914283485390340582924451051781021775107230697584955473705597515505582911995071572081209112144345022593992766962120099103362525526209288781594121511958419898880009958109610097900292014649873917718056919907184614,
   -0.9841830547185881494728294488071096110649905619258749086940073204285952378756268418605692872614185884013163957673519758317180836009229900608876564494831696937090191044323690614314506240106239812890453400663489623889016813551224775294808781622642601654645797161850389811214950825577959469929,
   0.9841830547185881494728294488071096110649905619258749086940073204285952378756268418605692872614185884013163957673519758317180836009229900608876564494831696937090191044323690614314506240106239812890453400663489623889016813551224775294808781622642601654645797161850389811214950825577959469929};
-#elif LEGENDRE_GAUSS_N == 14
-constexpr std::array<double, 14> abcissae {
+constexpr std::array<double, 14> abcissae_14 {
   -0.1080549487073436620662446502198347476119516054742375570408210613080135290117300071301006881766893672374502026424466474638099232632258191427567218197315040975280613727384226506948794430877532150884455563913298190602048364164800243197396659071012506161702814425014635643221773541001328892761,
   0.1080549487073436620662446502198347476119516054742375570408210613080135290117300071301006881766893672374502026424466474638099232632258191427567218197315040975280613727384226506948794430877532150884455563913298190602048364164800243197396659071012506161702814425014635643221773541001328892761,
   -0.3191123689278897604356718241684754668342612035338439565966501872573334405127927831649337054213464131802793151826090394496145640578710017716508863222239624560801212099312854217234880828771645863784793742391213044784251217681147835116435367778962949997448460558214759676525644841351801594858,
@@ -151,8 +136,7 @@ constexpr std::array<double, 14> abcissae {
   0.9284348836635735173363911393778742644770392104098376187179624474821310935443598531114139056836575176363551261559882603607008578010786539258018984540044065049415788809817953116114771913082523534585966056536730436866908555508986983297412486132245749388483890945436457404705549484348178721002,
   -0.9862838086968123388415972667040528016760914072392258816440708117777495541324916379106462396651517527602612562941358578689852603067447974494119727032471089820717007295567504818026168797055598944753969294261970695004471812726754299089862565428933676463914802477677291745002965827767360741735,
   0.9862838086968123388415972667040528016760914072392258816440708117777495541324916379106462396651517527602612562941358578689852603067447974494119727032471089820717007295567504818026168797055598944753969294261970695004471812726754299089862565428933676463914802477677291745002965827767360741735};
-#elif LEGENDRE_GAUSS_N == 15
-constexpr std::array<double, 15> abcissae {
+constexpr std::array<double, 15> abcissae_15 {
   0,
   -0.2011940939974345223006283033945962078128364544626376796159497246099482390030201876018362580675210590896790225738650942118942792830254885727862468296762689520472323105296106261124651357614417997418035121035408247749648194561179315250580457969565227012849978769073832577847806340363795749473,
   0.2011940939974345223006283033945962078128364544626376796159497246099482390030201876018362580675210590896790225738650942118942792830254885727862468296762689520472323105296106261124651357614417997418035121035408247749648194561179315250580457969565227012849978769073832577847806340363795749473,
@@ -168,8 +152,7 @@ constexpr std::array<double, 15> abcissae {
   0.9372733924007059043077589477102094712439962735153044579013630763502029737970455279505475861742680865974682404460315684492009513352834390536949245590430527861757465810011883749183601162731625066190523359799844459286625508280580877744877723444752122837802536842521085722280263813016978301407,
   -0.9879925180204854284895657185866125811469728171237614899999975155873884373690194247127220503683191449766751684399007925019395823670692057806992758567920785969340702791275630120497337228079229330198922312006979937161784084500767102113415768221050653691522462833296858362238239685728519647054,
   0.9879925180204854284895657185866125811469728171237614899999975155873884373690194247127220503683191449766751684399007925019395823670692057806992758567920785969340702791275630120497337228079229330198922312006979937161784084500767102113415768221050653691522462833296858362238239685728519647054};
-#elif LEGENDRE_GAUSS_N == 16
-constexpr std::array<double, 16> abcissae {
+constexpr std::array<double, 16> abcissae_16 {
   -0.0950125098376374401853193354249580631303530556890654566972198172251252982445921329847586929757833520996553912423163124483074773224487565507552825376683317590042639430675226808621968298306398385834094062354452738853673370952242716875153912021891680290435986783119557067235389351844245724875,
   0.0950125098376374401853193354249580631303530556890654566972198172251252982445921329847586929757833520996553912423163124483074773224487565507552825376683317590042639430675226808621968298306398385834094062354452738853673370952242716875153912021891680290435986783119557067235389351844245724875,
   -0.2816035507792589132304605014604961064860694907705998005488347339559251794991307704414402291520401592843373670756676799439586082317318595924277817407374616529972673172532181829993235047128041390568389016122167102956500177825088396891248315076199870306732893196077699300080783278160388268526,
@@ -186,8 +169,7 @@ constexpr std::array<double, 16> abcissae {
   0.9445750230732325760779884155346083450911392725910726009255536520666097889026823042195657287381583189493289311009073188864109526806102494798196007717799111788591676488419490727814170144843220494323478581257881972120927685699837677135359009690477976986581402819250512783872697998966630058366,
   -0.9894009349916499325961541734503326274262740716576451300512239047313241372158253969385364319067981810135134358598978665082530237078791797359303822324413999695095711078087727905307199080635719546126798380959938811380435009735652992230642464639938589347925375828009051127056909219223903533179,
   0.9894009349916499325961541734503326274262740716576451300512239047313241372158253969385364319067981810135134358598978665082530237078791797359303822324413999695095711078087727905307199080635719546126798380959938811380435009735652992230642464639938589347925375828009051127056909219223903533179};
-#elif LEGENDRE_GAUSS_N == 17
-constexpr std::array<double, 17> abcissae {
+constexpr std::array<double, 17> abcissae_17 {
   0,
   -0.1784841814958478558506774936540655574754193326915256435629518142706975504793005761702889222096350045795804136658695738694619191979106004270228012726401869233061635221498084388495367852285766359307626855910796829121983937561974468156386921610397465033747024112841920833242391965928122710019,
   0.1784841814958478558506774936540655574754193326915256435629518142706975504793005761702889222096350045795804136658695738694619191979106004270228012726401869233061635221498084388495367852285766359307626855910796829121983937561974468156386921610397465033747024112841920833242391965928122710019,
@@ -205,8 +187,7 @@ constexpr std::array<double, 17> abcissae {
   0.9506755217687677612227169578958030214433850465591087076699692124121153662721985947500369027514683577352656831114736735397342558536859079600136566154101961618491108090235156061787056766646529722765835833734963287469592882914043082555734640610770832418251007307942581964507076020992399886144,
   -0.9905754753144173356754340199406652765077898504595643027839087867423438574706220337113584406497419784359779955952757147938335817826095007304716840652816968608184996218958530105568632398642425148175768665003104870520333564613011532692326789295141276998299471031396925994336345025545551266343,
   0.9905754753144173356754340199406652765077898504595643027839087867423438574706220337113584406497419784359779955952757147938335817826095007304716840652816968608184996218958530105568632398642425148175768665003104870520333564613011532692326789295141276998299471031396925994336345025545551266343};
-#elif LEGENDRE_GAUSS_N == 18
-constexpr std::array<double, 18> abcissae {
+constexpr std::array<double, 18> abcissae_18 {
   -0.0847750130417353012422618529357838117333173869060899200433645176254997906532800016378045507274396124437829275672798731227331774869591555742707869354503347804827247386813860083492943153960827370950056849139593030465987915517910181494323385414322247870220801616210167503447932213563159478785,
   0.0847750130417353012422618529357838117333173869060899200433645176254997906532800016378045507274396124437829275672798731227331774869591555742707869354503347804827247386813860083492943153960827370950056849139593030465987915517910181494323385414322247870220801616210167503447932213563159478785,
   -0.2518862256915055095889728548779112301628617656596404580202710317367844935557242218070775421093862471964631424494432651250600548532785241952804861607909494284233921092736984549611801749674468819063730487487982301410941675444751653415111376578708966480260742797102399929583900718033759327209,
@@ -225,8 +206,7 @@ constexpr std::array<double, 18> abcissae {
   0.9558239495713977551811958929297763099728441348113064788453876296908980712047732239578823929596339243208559482466056887788906043119002511048689169938982404066468253675430144509701567089745157575736895029193279729376434486706077259413254472259577468248101576870177750661249908727294092126311,
   -0.9915651684209309467300160047061507702525789368454396929196756302398570935917796097517634696126012271523731072179779355873881301740594359250415621032096476004025642882577409246336921223339351585917712567917677623257005985578876226609693419436372609608161063669905409072224762588495765160794,
   0.9915651684209309467300160047061507702525789368454396929196756302398570935917796097517634696126012271523731072179779355873881301740594359250415621032096476004025642882577409246336921223339351585917712567917677623257005985578876226609693419436372609608161063669905409072224762588495765160794};
-#elif LEGENDRE_GAUSS_N == 19
-constexpr std::array<double, 19> abcissae {
+constexpr std::array<double, 19> abcissae_19 {
   0,
   -0.1603586456402253758680961157407435495048735004708753788746434516063206086803910736567395734994809129318483420183478796475911141450809718607901705094157416287827636723317712230366367245420707236761908155274983931420897352955705565372972610680898139803112996239542230328106130986249914194466,
   0.1603586456402253758680961157407435495048735004708753788746434516063206086803910736567395734994809129318483420183478796475911141450809718607901705094157416287827636723317712230366367245420707236761908155274983931420897352955705565372972610680898139803112996239542230328106130986249914194466,
@@ -246,8 +226,7 @@ constexpr std::array<double, 19> abcissae {
   0.9602081521348300308527788406876515266150915032741381059178163344322007499374885132207435614915413177254368192523164742167978833824318991613029627697107716004048389061572001566748259909558453570074951099472348857440923899276141697395726289443107249605043469217918612003537920025001631421361,
   -0.9924068438435844031890176702532604935893164014032107866796794390912319029585228838036749208734188013119794958338236088364145226980238478133549327801874434275998166833278883271648695176361368253792683042178805377659998449085455102400673694779767120278357276901409734267296826856483787011163,
   0.9924068438435844031890176702532604935893164014032107866796794390912319029585228838036749208734188013119794958338236088364145226980238478133549327801874434275998166833278883271648695176361368253792683042178805377659998449085455102400673694779767120278357276901409734267296826856483787011163};
-#elif LEGENDRE_GAUSS_N == 20
-constexpr std::array<double, 20> abcissae {
+constexpr std::array<double, 20> abcissae_20 {
   -0.0765265211334973337546404093988382110047962668134975008047952443842563420483369782415451141815562156069985056463641327044405378245712628847111887172768133849480713034639232220573314968967976578624002126908309880442644981195204905648677468155050797193996060978666309220354740163118897397462,
   0.0765265211334973337546404093988382110047962668134975008047952443842563420483369782415451141815562156069985056463641327044405378245712628847111887172768133849480713034639232220573314968967976578624002126908309880442644981195204905648677468155050797193996060978666309220354740163118897397462,
   -0.2277858511416450780804961953685746247430889376829274723146357392071713418635558277949521251909687080317737313156043021742990408764128121348527309473103510231012088770889101526899727869312951647279166230222083532237485779698033678575987234663095414012801053067685591624158148344361195752847,
@@ -268,8 +247,7 @@ constexpr std::array<double, 20> abcissae {
   0.9639719272779137912676661311972772219120603278061888560635375938920415807843830569800181252559647156313104349159642305288604107945950841916012896973856125442362722204039344929993138383198252917335788877307216356759417337912146196947795957049391561976704802249548893795179890457356617851265,
   -0.9931285991850949247861223884713202782226471309016558961481841312179847176277537808394494024965722092747289403472441901380148603873987776712384136792903672018478363391883474614446467923321455848994412127013518584596328653839755407926529209842664597749680291209275759831792849248136886138353,
   0.9931285991850949247861223884713202782226471309016558961481841312179847176277537808394494024965722092747289403472441901380148603873987776712384136792903672018478363391883474614446467923321455848994412127013518584596328653839755407926529209842664597749680291209275759831792849248136886138353};
-#elif LEGENDRE_GAUSS_N == 21
-constexpr std::array<double, 21> abcissae {
+constexpr std::array<double, 21> abcissae_21 {
   0,
   -0.1455618541608950909370309823386863301163260244379377574214883899855472808833197976905159784382084529956266082997952460007075040921151901820428112534471870024703724579332928837035079755367538815793316156146400158058153270917220808648193815275448927816510217795212659005404310120555536728913,
   0.1455618541608950909370309823386863301163260244379377574214883899855472808833197976905159784382084529956266082997952460007075040921151901820428112534471870024703724579332928837035079755367538815793316156146400158058153270917220808648193815275448927816510217795212659005404310120555536728913,
@@ -291,8 +269,7 @@ constexpr std::array<double, 21> abcissae {
   0.9672268385663062943166222149076951614246936873298468499529711280851209600050802879718374018639240527646293983749609070730588031439070533768944455074620467046102169941977006021847854662713269702363219945126440846238033747189487973795296995957404167028430371005551579646071964715083559627873,
   -0.9937521706203895002602420359379409291933384547823291855808738547130961090229928069981287471352390777288377053370241450143993363886632109591353148338638256333282393222478928076557337800765089605404093771754405796659131769242771089712887295358081081594782329648637555774855284519799161049686,
   0.9937521706203895002602420359379409291933384547823291855808738547130961090229928069981287471352390777288377053370241450143993363886632109591353148338638256333282393222478928076557337800765089605404093771754405796659131769242771089712887295358081081594782329648637555774855284519799161049686};
-#elif LEGENDRE_GAUSS_N == 22
-constexpr std::array<double, 22> abcissae {
+constexpr std::array<double, 22> abcissae_22 {
   -0.0697392733197222212138417961186280818222962994802314747066819465116093736326394460765183943704338544487872879297059588180033327284588814829765290589958930816827683819027975240010371384304403293006441518966800560096166835004986529663005334083512206079426025466748937247428751659198329275444,
   0.0697392733197222212138417961186280818222962994802314747066819465116093736326394460765183943704338544487872879297059588180033327284588814829765290589958930816827683819027975240010371384304403293006441518966800560096166835004986529663005334083512206079426025466748937247428751659198329275444,
   -0.2078604266882212854788465339195457342156751090979336496686533043682008413147176642165988241256992139747148429164396137301032053129758462919390218859076745053871930193737381045073535779470166381394472658147242493006733457683477445454896261295813361831250794375173965387698151085021081066977,
@@ -315,8 +292,7 @@ constexpr std::array<double, 22> abcissae {
   0.970060497835428727123950986765268710805968923137802969559738212336374260774842508637541354627034285352279221628282085920821738943924761292073863094841848350593733417267400496848644911329681669283632038639618777449965146871296034678966156471022308792123949727316682415329005015899062243619,
   -0.9942945854823992920730314211612989803930541983960315349770229249666564977040799118207719257762716042709613141325979204159359222397150371909847469699343828753811533349746520941374295276631590079995018537251129473876543314456515042300019276967404080443374797633943150099536799221717383492964,
   0.9942945854823992920730314211612989803930541983960315349770229249666564977040799118207719257762716042709613141325979204159359222397150371909847469699343828753811533349746520941374295276631590079995018537251129473876543314456515042300019276967404080443374797633943150099536799221717383492964};
-#elif LEGENDRE_GAUSS_N == 23
-constexpr std::array<double, 23> abcissae {
+constexpr std::array<double, 23> abcissae_23 {
   0,
   -0.133256824298466110931742682241766137010405276253382156510945377187047889875654477574563263596351401150478024810006155214780400785279364690777115364104216370366643505859625593971289644762107872837849711696324802659250750093546346426541476934229819633959536776286281510061433583517032941071,
   0.133256824298466110931742682241766137010405276253382156510945377187047889875654477574563263596351401150478024810006155214780400785279364690777115364104216370366643505859625593971289644762107872837849711696324802659250750093546346426541476934229819633959536776286281510061433583517032941071,
@@ -340,8 +316,7 @@ constexpr std::array<double, 23> abcissae {
   0.9725424712181152319560240768207773751816137953539739424912561587357970371745764178674174657439295146613283676103543079286662992825094333898813538421083861737096069764176018126271674915015133532457377919401697044302528761675843336349743308411408320776861181697417740947947574046223218533633,
   -0.994769334997552123523925715445574360573627372458870420926793884167074079765785270183989144216380134015528100132086012761027862156919983905768001102455401881479124785408487910346764109621757808705546848442769914412363434354363011581922801830117369192992652359139890772465735852828265814938,
   0.994769334997552123523925715445574360573627372458870420926793884167074079765785270183989144216380134015528100132086012761027862156919983905768001102455401881479124785408487910346764109621757808705546848442769914412363434354363011581922801830117369192992652359139890772465735852828265814938};
-#elif LEGENDRE_GAUSS_N == 24
-constexpr std::array<double, 24> abcissae {
+constexpr std::array<double, 24> abcissae_24 {
   -0.0640568928626056260850430826247450385909991954207473934243510817897392835939101078028928761342525090823242273835115756994869112500371756765277735374378372436515481804668409746233647956019276711845937319580510697455314397618513360822351096139837050674073737720614748330506959387258141490546,
   0.0640568928626056260850430826247450385909991954207473934243510817897392835939101078028928761342525090823242273835115756994869112500371756765277735374378372436515481804668409746233647956019276711845937319580510697455314397618513360822351096139837050674073737720614748330506959387258141490546,
   -0.1911188674736163091586398207570696318404051033147533561489185765880859526918717419824911112452097307135934146013595461392721542943443689459384015952736491888634107638852139839821480663334386199430823059446316182589874503457282270169922471283825305735240671464262733609193984099421023790425,
@@ -366,8 +341,7 @@ constexpr std::array<double, 24> abcissae {
   0.9747285559713094981983919930081690617411830530401787198115935651071811212809802245386374742817154549827412585755713491144798180281062083910290010368962899139003272102551955405455775700818480561392470581718221938768668731616756379649281934548623489251537698395239432800432811839537332490367,
   -0.9951872199970213601799974097007368118745976925960028774416005451142838320694577378833972893371157088623453462978965853994497237745715598401409351804188189455255566266162142239452364851560816782389596967291836243391359167365098731808888455424405665558369621091780571617968925046375452278564,
   0.9951872199970213601799974097007368118745976925960028774416005451142838320694577378833972893371157088623453462978965853994497237745715598401409351804188189455255566266162142239452364851560816782389596967291836243391359167365098731808888455424405665558369621091780571617968925046375452278564};
-#elif LEGENDRE_GAUSS_N == 25
-constexpr std::array<double, 25> abcissae {
+constexpr std::array<double, 25> abcissae_25 {
   0,
   -0.1228646926107103963873598188080368055322053460497837384238935378927088349688584158264388499463310553759776598041231980749579829863065684264274771835794511969653120305577453787335956360341410562132426408329702427684911575685834602213656534413787679485648367358853301436856737237735560396133,
   0.1228646926107103963873598188080368055322053460497837384238935378927088349688584158264388499463310553759776598041231980749579829863065684264274771835794511969653120305577453787335956360341410562132426408329702427684911575685834602213656534413787679485648367358853301436856737237735560396133,
@@ -393,8 +367,7 @@ constexpr std::array<double, 25> abcissae {
   0.9766639214595175114983153864795940677453705553144067446709874273161638675358805538964467094830061786681986598305464817463565747946416156626918121894236789619468165146949719792967548742913809943378910147548962013459459778695545785307245507808996798085059730837669417672653720665085384783378,
   -0.9955569697904980979087849468939016172575626494048081712108049311329334813437279344872880263529470075686825887042925551598228744883356392447452320467277362017840724808527091776881853182393497134867091171639915054270471292833163151481705407387722180585230262734389516808054049197427799632528,
   0.9955569697904980979087849468939016172575626494048081712108049311329334813437279344872880263529470075686825887042925551598228744883356392447452320467277362017840724808527091776881853182393497134867091171639915054270471292833163151481705407387722180585230262734389516808054049197427799632528};
-#elif LEGENDRE_GAUSS_N == 26
-constexpr std::array<double, 26> abcissae {
+constexpr std::array<double, 26> abcissae_26 {
   -0.0592300934293132070937185751984033607902347353890355821542722916843870361199734203384106268857877678198550897839977605940893211312251862007201662964743139324756301481912892195982893789066892077668501727246565183023470167683912835901964819243111723802266080530560715268863429511528456608972,
   0.0592300934293132070937185751984033607902347353890355821542722916843870361199734203384106268857877678198550897839977605940893211312251862007201662964743139324756301481912892195982893789066892077668501727246565183023470167683912835901964819243111723802266080530560715268863429511528456608972,
   -0.1768588203568901839690577484183447499773837638012642614803476997840452800554160871176150882635941013167365708202744959998694550004143591440689658109223823333814833363006613500488034219804089956043085313307672593244991820619683160974479700166763945830792347712576243758481806136907120452111,
@@ -421,8 +394,7 @@ constexpr std::array<double, 26> abcissae {
   0.978385445956470991100580354311926305446916563747318502485414861316505150745012471338934421241119597487299656422120553915250168141569953465251287328849517981986526368977442710768555706263248593255286340950676089668666289753538316177883252887412177724365323355392931555258143055708315272464,
   -0.9958857011456169290032169593229060259568578551195596673965278094055662966332778064519065880568373619497433860389580536264100926349771431376529363031935209365974267493674891357503236273914608309254638573138860265244347715252858899544196065228140709571716291936052481805556046228223228551059,
   0.9958857011456169290032169593229060259568578551195596673965278094055662966332778064519065880568373619497433860389580536264100926349771431376529363031935209365974267493674891357503236273914608309254638573138860265244347715252858899544196065228140709571716291936052481805556046228223228551059};
-#elif LEGENDRE_GAUSS_N == 27
-constexpr std::array<double, 27> abcissae {
+constexpr std::array<double, 27> abcissae_27 {
   0,
   -0.1139725856095299669328949838699766271732805339781409947657539097663654887884107453963794806397966295481168277152126517772178674675540939822477546258141231495107846160861841172928230400135240630536591240391139108161990662095371303547271346722370952680198979319548425437400631034298476710552,
   0.1139725856095299669328949838699766271732805339781409947657539097663654887884107453963794806397966295481168277152126517772178674675540939822477546258141231495107846160861841172928230400135240630536591240391139108161990662095371303547271346722370952680198979319548425437400631034298476710552,
@@ -450,8 +422,7 @@ constexpr std::array<double, 27> abcissae {
   0.9799234759615012228558733556610471845676422213899507632388598930523825759802189463054169755945038078440698195951537910018294444530762371492879829373876796337519011818523293350022728251470289880801449320201665145497607077894251910004718249646213262493945862537444829660478582686659005744912,
   -0.9961792628889885669388872083812299902606880555658711877016364967882177455773258120887620467215746222125086794886560144269772606411268216664924774902814308158646576693656426030172645369385634806705544288920184548472764982853976125713081751819462810291080244889328203715857484546966916049043,
   0.9961792628889885669388872083812299902606880555658711877016364967882177455773258120887620467215746222125086794886560144269772606411268216664924774902814308158646576693656426030172645369385634806705544288920184548472764982853976125713081751819462810291080244889328203715857484546966916049043};
-#elif LEGENDRE_GAUSS_N == 28
-constexpr std::array<double, 28> abcissae {
+constexpr std::array<double, 28> abcissae_28 {
   -0.0550792898840342704265165273418799778507959910608336837453385872588945445343075766484127254654299797214973501164993485704945865259107641152224797745340851727729444098362912404771634064674649525260474125521731086865339753283505512764813963694189922968797760456895239360225273202840506249275,
   0.0550792898840342704265165273418799778507959910608336837453385872588945445343075766484127254654299797214973501164993485704945865259107641152224797745340851727729444098362912404771634064674649525260474125521731086865339753283505512764813963694189922968797760456895239360225273202840506249275,
   -0.1645692821333807712814717778911654571457254156011681764942856266953318504756964478182443649797852074645303951256699503528162535403168329116318906470953061814295792889157304036697809579233724375392444416361380279898863615640513989010775071738790462084615855444131410701427812659781302295834,
@@ -480,8 +451,7 @@ constexpr std::array<double, 28> abcissae {
   0.9813031653708727536945599458078302764441549532531383096760256814587284519217767995019269270555137827173002393457924282210800595522365399080561740360074155353426707306849001658633097605489325031631973839412334504421520829856354046781302169647511819222235730014103907269215447067366550072823,
   -0.996442497573954449950436390483310991750130432096425904585672329490484218961068725320715406608400390653652503711909038010286254877419182616000223668599697467282958117937279359151531949693236576007431168877249563309651810507438203148982783241735303914551789349288023660544224639061915399203,
   0.996442497573954449950436390483310991750130432096425904585672329490484218961068725320715406608400390653652503711909038010286254877419182616000223668599697467282958117937279359151531949693236576007431168877249563309651810507438203148982783241735303914551789349288023660544224639061915399203};
-#elif LEGENDRE_GAUSS_N == 29
-constexpr std::array<double, 29> abcissae {
+constexpr std::array<double, 29> abcissae_29 {
   0,
   -0.1062782301326792301709823924303769809171954392956071362857752740221653437515846409430044606205654171510105058684437935299413016219896248241912080826033190820394727992121071888625924083664164006279520048308340788918353798874526129004645399054858544411297516832779517007035028079102404263573,
   0.1062782301326792301709823924303769809171954392956071362857752740221653437515846409430044606205654171510105058684437935299413016219896248241912080826033190820394727992121071888625924083664164006279520048308340788918353798874526129004645399054858544411297516832779517007035028079102404263573,
@@ -511,8 +481,7 @@ constexpr std::array<double, 29> abcissae {
   0.9825455052614131748709260157863769561067819489064315590251200914466725857156303835521726347161469228036952763606735421680958880320200430131008199028998763069178157687415512428116308167151347014048263219526093744436690827485339913118488938201476904903068255115300866866489996534198197509411,
   -0.9966794422605965861631915325493538856517734532508800021981573237567855859944197443375239635794152036149318443879158636795975070915166633478825202929293875884895923904575223255806130784143023738380199203756238062052696334397812760126536847613904524633040713014440002352335350484214113377154,
   0.9966794422605965861631915325493538856517734532508800021981573237567855859944197443375239635794152036149318443879158636795975070915166633478825202929293875884895923904575223255806130784143023738380199203756238062052696334397812760126536847613904524633040713014440002352335350484214113377154};
-#elif LEGENDRE_GAUSS_N == 30
-constexpr std::array<double, 30> abcissae {
+constexpr std::array<double, 30> abcissae_30 {
   -0.0514718425553176958330252131667225737491414536665695642551608439879647552104271090558700907072854858412170899635906782855404191129702728808523144530392232654264631183554440197685971331042752378626568812513629962453619937700252386253290921395290926823329112338749353087625023188601027243615,
   0.0514718425553176958330252131667225737491414536665695642551608439879647552104271090558700907072854858412170899635906782855404191129702728808523144530392232654264631183554440197685971331042752378626568812513629962453619937700252386253290921395290926823329112338749353087625023188601027243615,
   -0.1538699136085835469637946727432559204185519712443384617189629829157871485108161013969231065107407855799011175495206195335050517724180031262813716150461397152106711242582382929789309259204408368523080956323187158211209000384086388768007877084154359661105612565474641295806464472440559613154,
@@ -543,8 +512,7 @@ constexpr std::array<double, 30> abcissae {
   0.9836681232797472099700325816056628019403178547097113635171800101511442953647910437020759716603547136805776256013720933120159978135497748147525677352954213015974652412982556869910645908793741157112662996545425630303876298216871671993299786197221740081918230048017337834905169066884026623134,
   -0.9968934840746495402716300509186952833408820381177507901080942978023876952101637408158820195580617174125740509596381683164378022460308452558361621231532766166921355494851282927517945807022184342414275090237509023717839165888266876366861770930220851822663347709393957573720880662743214778986,
   0.9968934840746495402716300509186952833408820381177507901080942978023876952101637408158820195580617174125740509596381683164378022460308452558361621231532766166921355494851282927517945807022184342414275090237509023717839165888266876366861770930220851822663347709393957573720880662743214778986};
-#elif LEGENDRE_GAUSS_N == 31
-constexpr std::array<double, 31> abcissae {
+constexpr std::array<double, 31> abcissae_31 {
   0,
   -0.0995553121523415203251747901189407338389953587775273060602270909772698755295960660655777180314642071830680588574656752927910304390562323289106168290594237317551324196094774502446174862493936689447529072383754006033674108051830746549889043395773299470482343464977160614943946070412139057042,
   0.0995553121523415203251747901189407338389953587775273060602270909772698755295960660655777180314642071830680588574656752927910304390562323289106168290594237317551324196094774502446174862493936689447529072383754006033674108051830746549889043395773299470482343464977160614943946070412139057042,
@@ -576,8 +544,7 @@ constexpr std::array<double, 31> abcissae {
   0.9846859096651524840024651667346847109385182695146436709457286593954599538885447274880874459599980801646734380574648748717805745137117726765221385819800265786519971567536020801608899258557348733228633831775169144732178685715199260871453411122474318175481553374300996209601291614053701273861,
   -0.9970874818194770740556265542231025082514453341170696307921237189266565447208604330223433712052469459111569798351359497730545460468236016333324634710941128330094340879971979579224600638457249011971524880974039565702758986130508191252392694532973845776213651717409188052665390032676623730845,
   0.9970874818194770740556265542231025082514453341170696307921237189266565447208604330223433712052469459111569798351359497730545460468236016333324634710941128330094340879971979579224600638457249011971524880974039565702758986130508191252392694532973845776213651717409188052665390032676623730845};
-#elif LEGENDRE_GAUSS_N == 32
-constexpr std::array<double, 32> abcissae {
+constexpr std::array<double, 32> abcissae_32 {
   -0.0483076656877383162348125704405021636908472517308488971677937345463685926042778777794060365911173780988289503411375793689757446357461295741679964108035347980667582792392651327368009453047606446744575790523465655622949909588624860214137051585425884056992683442137333250625173849291299678673,
   0.0483076656877383162348125704405021636908472517308488971677937345463685926042778777794060365911173780988289503411375793689757446357461295741679964108035347980667582792392651327368009453047606446744575790523465655622949909588624860214137051585425884056992683442137333250625173849291299678673,
   -0.1444719615827964934851863735988106522038459913156355521379528938242184438164519731102406769974924713989580220758441301598578946580142268413547299935841673092513202403499286272686350814272974392746706128556678811982653393383080797337231702069432462445053984587997153683967433095128570624414,
@@ -610,8 +577,7 @@ constexpr std::array<double, 32> abcissae {
   0.9856115115452683354001750446309019786323957143358063182107821705820305847193755946663846485510970266115353839862364606643634021712823093784875255943834038377710426488328772047833289470320023596895438028281274741367781028592272459887917924171204666683239464005128153533797603112851826904814,
   -0.9972638618494815635449811286650407271385376637294611593011185457862359083917418520130456693085426416474280482200936551645510686196373231416035137741332968299789863385253514914078766236061488136738023162574655835389902337937054326098485227311719825229066712510246574949376367552421728646398,
   0.9972638618494815635449811286650407271385376637294611593011185457862359083917418520130456693085426416474280482200936551645510686196373231416035137741332968299789863385253514914078766236061488136738023162574655835389902337937054326098485227311719825229066712510246574949376367552421728646398};
-#elif LEGENDRE_GAUSS_N == 33
-constexpr std::array<double, 33> abcissae {
+constexpr std::array<double, 33> abcissae_33 {
   0,
   -0.0936310658547333856707429241225377213215057781526368812820251957928940047486465207459264717806735203559466438831715026868949584330828987584415999259593083601446684914851305090840563041240593846072167596908399489786085914212638411071895096171044122908863920917813747493999284278046447288468,
   0.0936310658547333856707429241225377213215057781526368812820251957928940047486465207459264717806735203559466438831715026868949584330828987584415999259593083601446684914851305090840563041240593846072167596908399489786085914212638411071895096171044122908863920917813747493999284278046447288468,
@@ -645,8 +611,7 @@ constexpr std::array<double, 33> abcissae {
   0.9864557262306424881103756982646259215891711142156510997230556582361525294511083603869800035304516817158728141769217990553343883393012388446402531103634331490573413813721032195807615219305599067196796084315912327826122662481335806498495363735874858019360615989913989055996836368869842022723,
   -0.9974246942464552172661680175804041610782290108813619207170401330854448195122714817328599891028309377026752208353294447318387893364516066824116622377988464293453002316447520586824484198339049776542152353238820995895995166652032601619826542573882300666258747258041260693686734387286431323656,
   0.9974246942464552172661680175804041610782290108813619207170401330854448195122714817328599891028309377026752208353294447318387893364516066824116622377988464293453002316447520586824484198339049776542152353238820995895995166652032601619826542573882300666258747258041260693686734387286431323656};
-#elif LEGENDRE_GAUSS_N == 34
-constexpr std::array<double, 34> abcissae {
+constexpr std::array<double, 34> abcissae_34 {
   -0.0455098219531025427490756708519301638310841501872054020244250948683604853949396379143247293329158600722260966288606559905051129464870312737640810994348369951561033839485371185684284025049349003876725668061427936709653494378506995537930887814214850230287293713342350420022497966302744749399,
   0.0455098219531025427490756708519301638310841501872054020244250948683604853949396379143247293329158600722260966288606559905051129464870312737640810994348369951561033839485371185684284025049349003876725668061427936709653494378506995537930887814214850230287293713342350420022497966302744749399,
   -0.1361523572591829758944288243311178314972806177645362821058074023867090221073300705071830913804907464108716307097315791923202574611764485346173571276629558360899265950003012762162283795437199816372256368061894517774621516301589209034343863570461647783953136458901669013900489004588077886828,
@@ -681,8 +646,7 @@ constexpr std::array<double, 34> abcissae {
   0.9872278164063094850497504310996849729487701486601322192344089006574902036003160910896163754117365156335343332174617289839732576235349344164770507731287181472383118356330256569645341321538544320210384018957374606113820417938777491216258268312308568212683310317542531084891553274179364926302,
   -0.9975717537908419192433724374546292314005098826849297729399442965525721299550802652164143971150062160605512014983059883958269625291319700852091958580296946904585410771831017352358053928017651634830044706070544058300586804823137354904106223802638921228612737997102272041942967334066087055003,
   0.9975717537908419192433724374546292314005098826849297729399442965525721299550802652164143971150062160605512014983059883958269625291319700852091958580296946904585410771831017352358053928017651634830044706070544058300586804823137354904106223802638921228612737997102272041942967334066087055003};
-#elif LEGENDRE_GAUSS_N == 35
-constexpr std::array<double, 35> abcissae {
+constexpr std::array<double, 35> abcissae_35 {
   0,
   -0.0883713432756592636009294334975488034241174347650981413972508666818661225143263338656760844223666705379149651868059178919219080319945212758924444058033655787897646494393189208281663021604630367620800945354492352436927876819192953382153792605724917934462773413753382951773353438517980738343,
   0.0883713432756592636009294334975488034241174347650981413972508666818661225143263338656760844223666705379149651868059178919219080319945212758924444058033655787897646494393189208281663021604630367620800945354492352436927876819192953382153792605724917934462773413753382951773353438517980738343,
@@ -718,8 +682,7 @@ constexpr std::array<double, 35> abcissae {
   0.9879357644438514980351170891854859853130082957141743547561139575477141904737237553515848893409043922134655774143833947082943028967680910249209353986343208217449070840843933807287395132045181096739289218791115522126195585078802925728691280269646752729594030984292769332059846735816853822626,
   -0.997706569099600297260163139312094725193274637171013316592297713742519108727963743288756634006227298089629166618692719994883076959583084626375430350062396007631544978606761991483678806126540062095600939552738997717993832114064333518564997679148258055437755132247284722196932104590160524157,
   0.997706569099600297260163139312094725193274637171013316592297713742519108727963743288756634006227298089629166618692719994883076959583084626375430350062396007631544978606761991483678806126540062095600939552738997717993832114064333518564997679148258055437755132247284722196932104590160524157};
-#elif LEGENDRE_GAUSS_N == 36
-constexpr std::array<double, 36> abcissae {
+constexpr std::array<double, 36> abcissae_36 {
   -0.0430181984737086072269689782283634345542947948060091897684001805588207970036525604226355932503748168093594546640700340295111525563329028911897433681601360869044181627247719454065479805116946621451811425216217065294083969685457200422868935431582905203854326661866765553054483284472996638251,
   0.0430181984737086072269689782283634345542947948060091897684001805588207970036525604226355932503748168093594546640700340295111525563329028911897433681601360869044181627247719454065479805116946621451811425216217065294083969685457200422868935431582905203854326661866765553054483284472996638251,
   -0.128736103809384788651993388005152301177289724599373133605902891035306123614618552050473432571649983975638157374475929768808835915836608532674777418787520183865521671021139146861115173593765403331051655398639639666171155231183534281390725560419887082936588558708571533286430134103453561326,
@@ -756,8 +719,7 @@ constexpr std::array<double, 36> abcissae {
   0.9885864789022122380733951078771074466071625200652870557881915271345414069158205223748385901289387396661987114680831372707844908508005437128667611289793080810615327620051160479832945910313769176545733764162016953668299316163620429059842527204437977129585578605191153794597467329039251170951,
   -0.9978304624840858361988283455807502386498164623966313125905411677997313605670588974595733156496611358025843013833092029581538461275116766439499686870566709128769094917521270961279491962343517798303192993049434061580308738988791580963092083798047495117386896776189100500967168286076195483592,
   0.9978304624840858361988283455807502386498164623966313125905411677997313605670588974595733156496611358025843013833092029581538461275116766439499686870566709128769094917521270961279491962343517798303192993049434061580308738988791580963092083798047495117386896776189100500967168286076195483592};
-#elif LEGENDRE_GAUSS_N == 37
-constexpr std::array<double, 37> abcissae {
+constexpr std::array<double, 37> abcissae_37 {
   0,
   -0.0836704089547699019430483317363991775635216320351522936152933176455414050863186799017698946064201392562506849638152812304192677053038867734317286697969552262501536311500146040803682161861583227455988990896919212706252416922656067102868162531936565366173880115367378151112646752823447743573,
   0.0836704089547699019430483317363991775635216320351522936152933176455414050863186799017698946064201392562506849638152812304192677053038867734317286697969552262501536311500146040803682161861583227455988990896919212706252416922656067102868162531936565366173880115367378151112646752823447743573,
@@ -795,8 +757,7 @@ constexpr std::array<double, 37> abcissae {
   0.9891859632143191866840990605842723089624529175806739804760216455546773826380671137776561251868840047145405438988488094900742509517482695718265138500087211747636446926067201643996716397645844594194090095847944294657028059212656511364784159057087906325799495016539829985951440958088969699176,
   -0.9979445824779136489408030743173632836690078494867291540688267746863324777757819688727654263227029820281021960820628637805282346133923567905135963608070332846905371550093471887246009797130760101554566179604401224942187829462024247867742298222034961501481724975738808492170481814821534641624,
   0.9979445824779136489408030743173632836690078494867291540688267746863324777757819688727654263227029820281021960820628637805282346133923567905135963608070332846905371550093471887246009797130760101554566179604401224942187829462024247867742298222034961501481724975738808492170481814821534641624};
-#elif LEGENDRE_GAUSS_N == 38
-constexpr std::array<double, 38> abcissae {
+constexpr std::array<double, 38> abcissae_38 {
   -0.0407851479045782399133164323297849207847736426836548116935974778259399967500690234895840618226155549129982854246738099611005359242656183153838695925419452080192437811263762783354064004445193580227878614318228079570045169664314968653199288402999007588626846782058142896450158433447973411187,
   0.0407851479045782399133164323297849207847736426836548116935974778259399967500690234895840618226155549129982854246738099611005359242656183153838695925419452080192437811263762783354064004445193580227878614318228079570045169664314968653199288402999007588626846782058142896450158433447973411187,
   -0.1220840253378674198696123813294071165681181414993000088037745510996371151988704184765198202152345198321107166720120243741300167333845833449907982822624803279837953727821297837889506000500303453310791075437676709688330481606243313818985592147886677668773080746844239965138506952948856199054,
@@ -835,8 +796,7 @@ constexpr std::array<double, 38> abcissae {
   0.9897394542663855719444258911056793473243812469080222063838314990738588956493016881458138665353391265218854757816642382229846984673611790015352422220966822016772001723861780871441428722351400666426728990571430880333042570017721499615526670791599829502155990828063146809349579608909666722819,
   -0.9980499305356876198128470765515809974904653702745880901607443940139348595515166700882640925126086848353532659625191604229888026859390699340181237848617802304847467284152010720002778119121338543224871675570944920093329339106385213311051213023875110360435233042859503016171489774735327253913,
   0.9980499305356876198128470765515809974904653702745880901607443940139348595515166700882640925126086848353532659625191604229888026859390699340181237848617802304847467284152010720002778119121338543224871675570944920093329339106385213311051213023875110360435233042859503016171489774735327253913};
-#elif LEGENDRE_GAUSS_N == 39
-constexpr std::array<double, 39> abcissae {
+constexpr std::array<double, 39> abcissae_39 {
   0,
   -0.0794438046087554775819170831926406468850031651067419332552293916746906405843207105218011652505044895475366886846261763450099459812637643053474684951625012013292136416275960508834677265995745354667243069202373637296540794197571881009753980210679953460862353082950696859015431603315449891264,
   0.0794438046087554775819170831926406468850031651067419332552293916746906405843207105218011652505044895475366886846261763450099459812637643053474684951625012013292136416275960508834677265995745354667243069202373637296540794197571881009753980210679953460862353082950696859015431603315449891264,
@@ -876,8 +836,7 @@ constexpr std::array<double, 39> abcissae {
   0.9902515368546859836397751172470782047096938210401917962588294195834722376246862160419391535957080401970121989981987592272175425045434453252287313517858403066033375417468167001245305111782372957100712848469232915931587079802450142929638129292104971098982783843690985495836031181089880509471,
   -0.9981473830664329060054723028518204418320097400496642117612179179650092121573305537571631385801434305575920903766119693565558849704855298170189110205582358695469915747821922563809372922076463418917807414771381125471796267733556252079651198377811184681576085314818301633322988653909324530375,
   0.9981473830664329060054723028518204418320097400496642117612179179650092121573305537571631385801434305575920903766119693565558849704855298170189110205582358695469915747821922563809372922076463418917807414771381125471796267733556252079651198377811184681576085314818301633322988653909324530375};
-#elif LEGENDRE_GAUSS_N == 40
-constexpr std::array<double, 40> abcissae {
+constexpr std::array<double, 40> abcissae_40 {
   -0.0387724175060508219331934440246232946793646343831415991686371814380065750009207562086042738063514843900740720936834079453973320780490382668951180110474166261315839949200261083848853078015066473021563104420605364428655010372310398407500879846856979806260346749479540591420129798011298065484,
   0.0387724175060508219331934440246232946793646343831415991686371814380065750009207562086042738063514843900740720936834079453973320780490382668951180110474166261315839949200261083848853078015066473021563104420605364428655010372310398407500879846856979806260346749479540591420129798011298065484,
   -0.1160840706752552084834512844080241137687285308542159490302974321615791639478671735153771134610938427797368020682710027396461829046568432662618737006287454239959800560578326496481977855895512739168365424763715320662091420043156944036815055875474248335752944260913450868338578230277431777387,
@@ -918,8 +877,7 @@ constexpr std::array<double, 40> abcissae {
   0.9907262386994570064530543522213721549622220813510865378830762443040789032385445966291105059825021678098495682760597336211971546432886185883314956337485516864330212694006044030016395477282616785959093287915090727554052676614935503968760713699338471104841229808231231300279920758541233926572,
   -0.998237709710559200349622702420586492335770381595045906603336117096838863019727805077886187731208284346697196268812609614867897550598426581197494366244590175438859840302626210784505751330455981422943288946136895214190796691246391128558183957283158133521955987932442044279216204993487154415,
   0.998237709710559200349622702420586492335770381595045906603336117096838863019727805077886187731208284346697196268812609614867897550598426581197494366244590175438859840302626210784505751330455981422943288946136895214190796691246391128558183957283158133521955987932442044279216204993487154415};
-#elif LEGENDRE_GAUSS_N == 41
-constexpr std::array<double, 41> abcissae {
+constexpr std::array<double, 41> abcissae_41 {
   0,
   -0.0756232589891629969237661936512002674810506356066569487501038170943591679222303921523402083259610755496703772137517720171641921084278907133236887500241782758754779848260720820452505068427413924914200608686490399550118032052387382600726424493629392215984855719796240571574821194805397158466,
   0.0756232589891629969237661936512002674810506356066569487501038170943591679222303921523402083259610755496703772137517720171641921084278907133236887500241782758754779848260720820452505068427413924914200608686490399550118032052387382600726424493629392215984855719796240571574821194805397158466,
@@ -961,8 +919,7 @@ constexpr std::array<double, 41> abcissae {
   0.9911671096990163082501588945731696576927560135700030473139233758752984652122903813804159282310382464791393720182583773316945845961745503955637243329945634061990912496176040050366687001970664504129152547457472607986430099695332474857354696159207863491129627820235384915159362332440949567662,
   -0.9983215885747714415191885080883775679315043515136701664305189995082435292455981069034539790605563825750131855265033708088981618877268356563926199753830375426358692803185946565112045452283751949024159636344229132719337245450635388803496101776779825366033502853468402594696424625388274781776,
   0.9983215885747714415191885080883775679315043515136701664305189995082435292455981069034539790605563825750131855265033708088981618877268356563926199753830375426358692803185946565112045452283751949024159636344229132719337245450635388803496101776779825366033502853468402594696424625388274781776};
-#elif LEGENDRE_GAUSS_N == 42
-constexpr std::array<double, 42> abcissae {
+constexpr std::array<double, 42> abcissae_42 {
   -0.036948943165351775813095980037559426641708452249222531349645010606524170696083857530217773875697544219694960358827157795471132563885638090996704528323264466430993885971645993259311353863621242990960854011741930567893057625795921707578222152604375823902628714171641992059378640522132965463,
   0.036948943165351775813095980037559426641708452249222531349645010606524170696083857530217773875697544219694960358827157795471132563885638090996704528323264466430993885971645993259311353863621242990960854011741930567893057625795921707578222152604375823902628714171641992059378640522132965463,
   -0.1106450272085198683491225450026410048673440244836308074034761448800633088328708252925406909348536470975394047810493795607933982991675485254062085364712614493975058077444889113202216338127409940795075581361747411764977429438030978771211075608192492175399458405070664490227272083047479140831,
@@ -1005,8 +962,7 @@ constexpr std::array<double, 42> abcissae {
   0.9915772883408609197923612532808688334526932647371040175768790481316447314960557033137656250635902567810454367784950864833239224467788004673299197279355346415546742854993501877475723429653375154521906014493292918364920011124398849358085798088044012154867507977301175318448410825216809766932,
   -0.9983996189900624150228681268470502761778760835227812517648555025451016880458536437225602120670189934204340006058217799876323866722828529314773378365425690716107333092665424278926911308978100755507869014368657386787666717359023176323550568549678924893045537365733679999437483735615248566727,
   0.9983996189900624150228681268470502761778760835227812517648555025451016880458536437225602120670189934204340006058217799876323866722828529314773378365425690716107333092665424278926911308978100755507869014368657386787666717359023176323550568549678924893045537365733679999437483735615248566727};
-#elif LEGENDRE_GAUSS_N == 43
-constexpr std::array<double, 43> abcissae {
+constexpr std::array<double, 43> abcissae_43 {
   0,
   -0.0721529908745862354223272509555610948576552766606143055244704431550256872284532261768467243637803513354191341491144843148004794568162451285778956771966712810349233859243127697993421530827384514842436920333163077469272359447318156736310702869246801718595027046354816034095716823162063528691,
   0.0721529908745862354223272509555610948576552766606143055244704431550256872284532261768467243637803513354191341491144843148004794568162451285778956771966712810349233859243127697993421530827384514842436920333163077469272359447318156736310702869246801718595027046354816034095716823162063528691,
@@ -1050,8 +1006,7 @@ constexpr std::array<double, 43> abcissae {
   0.9919595575932441464207183413296180163870532259589527282146822001860563804428163213193924912735756282032174645133833445087563657125117823326360206138995237659401723996947276017528543314843706958203138021557251982705518263215789918756956855973900342318539586468980939489148316216104253844578,
   -0.9984723322425077135176361873183924119620507178476091432930834367833803290305468656358295283544157007271916046020116010321389842977808415142126955315107798346199633858126139791245744880965834357105662452736321168500952436732053338986715362444230741222049336461953923105204803128295886619056,
   0.9984723322425077135176361873183924119620507178476091432930834367833803290305468656358295283544157007271916046020116010321389842977808415142126955315107798346199633858126139791245744880965834357105662452736321168500952436732053338986715362444230741222049336461953923105204803128295886619056};
-#elif LEGENDRE_GAUSS_N == 44
-constexpr std::array<double, 44> abcissae {
+constexpr std::array<double, 44> abcissae_44 {
   -0.0352892369641353590581967046314163558850021975895270767771388050026708293129204296538088503405177394704904068432241515798528419456417467129317841397971244337295076320014668142807439854372285560782940231746230660848399854169482044830132966885947763510923563227341169364307311155993362997823,
   0.0352892369641353590581967046314163558850021975895270767771388050026708293129204296538088503405177394704904068432241515798528419456417467129317841397971244337295076320014668142807439854372285560782940231746230660848399854169482044830132966885947763510923563227341169364307311155993362997823,
   -0.105691901708653247117305848915121752383385998859597613782401496431801112854648588967954920974066900109572104138324971369950267892662922135908391879396983818698616161584758434002196531897290200708390100805988660460674889279970651810967849891465885572299440740394506655747259661937212538541,
@@ -1096,8 +1051,7 @@ constexpr std::array<double, 44> abcissae {
   0.9923163921385158084833380036135385688118977843522100774582564757323982234648015796641238475803734174553927168666062984265566870307527977780609711977334937349699589139696682932883757076173715545229694325681197652093043915942817200409357633651580410056269200570075644497983062201850776628678,
   -0.9985402006367742249360567206066503490560300331754145979988481656824135483072647580556639621594218549657048266489306763785891069988814966409213836838335483208442604184093408978984981414233549701766451336435863927930939337442958902165870292619783586971372987415936904294458208327098983301062,
   0.9985402006367742249360567206066503490560300331754145979988481656824135483072647580556639621594218549657048266489306763785891069988814966409213836838335483208442604184093408978984981414233549701766451336435863927930939337442958902165870292619783586971372987415936904294458208327098983301062};
-#elif LEGENDRE_GAUSS_N == 45
-constexpr std::array<double, 45> abcissae {
+constexpr std::array<double, 45> abcissae_45 {
   0,
   -0.0689869801631441724904146141038117296939206669309696826654092552885288924897645047758907450617168447758105762833790309989070623554992199732665069165637914364080323057829543417323457482966517027110115517137460532128939840707013066763214276126248552457879589052906480471366861032295909846184,
   0.0689869801631441724904146141038117296939206669309696826654092552885288924897645047758907450617168447758105762833790309989070623554992199732665069165637914364080323057829543417323457482966517027110115517137460532128939840707013066763214276126248552457879589052906480471366861032295909846184,
@@ -1143,8 +1097,7 @@ constexpr std::array<double, 45> abcissae {
   0.992649998447203741748617120597735344975001643303639350616987928300824197099942464642166179243808500375007059976130448602137203271792310115462484919958221293554259365215049226417701159969978541700095389713394961460685043681571269967582607859007992196798791007649748420078640507372428057378,
   -0.9986036451819366381565476769008205480922885272144754168889563981367847211485815564200976016079688820193014306634106495433588005941522936836310764651469951814816662549490621415441190099278212055876401746905049718706861317535614698526960295990767435128872858263570100908875722465970759271536,
   0.9986036451819366381565476769008205480922885272144754168889563981367847211485815564200976016079688820193014306634106495433588005941522936836310764651469951814816662549490621415441190099278212055876401746905049718706861317535614698526960295990767435128872858263570100908875722465970759271536};
-#elif LEGENDRE_GAUSS_N == 46
-constexpr std::array<double, 46> abcissae {
+constexpr std::array<double, 46> abcissae_46 {
   -0.0337721900160520415195578318914397638159161159962019206821051777282625013199129883154032185359908371001907211070629873764939459920390989819586832755353237410904778015609096787902184029359935084343494538258762838909218497245746528474442371709282676930736213697644051456588580681636800032697,
   0.0337721900160520415195578318914397638159161159962019206821051777282625013199129883154032185359908371001907211070629873764939459920390989819586832755353237410904778015609096787902184029359935084343494538258762838909218497245746528474442371709282676930736213697644051456588580681636800032697,
   -0.101162475305584239515859657008649390881871360501493739619515960454422900570498073287493777140387839816126841292416227335274675288073899841527137974724165082215685866225382249170808404647625107226745828617674073281486603455031647611932607075024749580073244349652369984444972923581710601124,
@@ -1191,8 +1144,7 @@ constexpr std::array<double, 46> abcissae {
   0.9929623489061743640730954446661934091211028309083840251988476174226641125303255012408605697400441713307379503287798434798744031617080950211424775798364305981472428154723427980513961167727120691888229371413911400272065865405145926977790007356846414340476646259442523884976605625938407874595,
   -0.9986630421338179811282684173908887745841556074346317260911055450026776598114654117071922344578388881161508344754793190535167328691318039871920520584027347438585963357439016798601563550392106296626966522622336912475962706832547887040005068075788391652115420146726572022865383721316752323089,
   0.9986630421338179811282684173908887745841556074346317260911055450026776598114654117071922344578388881161508344754793190535167328691318039871920520584027347438585963357439016798601563550392106296626966522622336912475962706832547887040005068075788391652115420146726572022865383721316752323089};
-#elif LEGENDRE_GAUSS_N == 47
-constexpr std::array<double, 47> abcissae {
+constexpr std::array<double, 47> abcissae_47 {
   0,
   -0.0660869239163556751604737774741337085922762739362204088722755555839727101596731021576668306222635342336817548364931739218741799661933158114369109989230489377020329747464232281827190531860889344437069290269439885133955479507608860348426550448887005099649771098576516934573044525257355643265,
   0.0660869239163556751604737774741337085922762739362204088722755555839727101596731021576668306222635342336817548364931739218741799661933158114369109989230489377020329747464232281827190531860889344437069290269439885133955479507608860348426550448887005099649771098576516934573044525257355643265,
@@ -1240,8 +1192,7 @@ constexpr std::array<double, 47> abcissae {
   0.9932552109877686346921896846324636081457120841106307345393096809645288231830581014930790423193963327440858971978470011189090798810287623025630844801376602537037045398232788736386225012824762633030237435326409721634953609139863045504068378668341605348813150282849999893979541112691343561994,
   -0.998718728584212109183947714787108491627090651231490809215968162548578769219829329795457682502153384859449621288528450971833214085768232940829548976395312045777101444457698258480533884211880240305345916254832976518811652728488140269708485373013478912786276120325880844647187134869298908779,
   0.998718728584212109183947714787108491627090651231490809215968162548578769219829329795457682502153384859449621288528450971833214085768232940829548976395312045777101444457698258480533884211880240305345916254832976518811652728488140269708485373013478912786276120325880844647187134869298908779};
-#elif LEGENDRE_GAUSS_N == 48
-constexpr std::array<double, 48> abcissae {
+constexpr std::array<double, 48> abcissae_48 {
   -0.0323801709628693620333222431521344420459628023615180924250032200173778192033824263362735606192681682400367095349344164805253339336387227562143033309933613048005985693434381987818201481883459708779882194210519641874072840153368237061052666187976157919313172960863861628381000595094587588988,
   0.0323801709628693620333222431521344420459628023615180924250032200173778192033824263362735606192681682400367095349344164805253339336387227562143033309933613048005985693434381987818201481883459708779882194210519641874072840153368237061052666187976157919313172960863861628381000595094587588988,
   -0.097004699209462698930053955853624520152736229300936986430580765944804036262622285099333696696838482251782946732767916338280146687215461892885262614507377477016216369626353734517704634998485497845287278557096944336844633510368214754716443206792414853127255583775294604837750153713907779125,
@@ -1290,8 +1241,7 @@ constexpr std::array<double, 48> abcissae {
   0.9935301722663507575479287508490741183566147495946719296171518380987546182067771786290419810076653658707794725617515799662389829710022177318209380664631193614136055345075703607668275077740411649842085541887030219645923098582169161303385895586016157196262331334058188227333163347469240571803,
   -0.9987710072524261186005414915631136400889376502767210386129404813754588436074917000156558049981457228323111399757426667107783686146764979424301931921202864901934760728750598495567831609976798771170638384784993532847474526751192964462907047527007519731784755343424413652889476747582001549614,
   0.9987710072524261186005414915631136400889376502767210386129404813754588436074917000156558049981457228323111399757426667107783686146764979424301931921202864901934760728750598495567831609976798771170638384784993532847474526751192964462907047527007519731784755343424413652889476747582001549614};
-#elif LEGENDRE_GAUSS_N == 49
-constexpr std::array<double, 49> abcissae {
+constexpr std::array<double, 49> abcissae_49 {
   0,
   -0.0634206849826867860288348208784849731527868727788803874902091383688046365488916875598326044283856451003174784921844073291505051127394466250629711670151463539816232517230067389111952163076115209711456343470414370416414862392712844791048076929590324756779097430115887457903829862264840052683,
   0.0634206849826867860288348208784849731527868727788803874902091383688046365488916875598326044283856451003174784921844073291505051127394466250629711670151463539816232517230067389111952163076115209711456343470414370416414862392712844791048076929590324756779097430115887457903829862264840052683,
@@ -1341,8 +1291,7 @@ constexpr std::array<double, 49> abcissae {
   0.9937886619441677907601138592579536188413073949386501676046027865246301118465520881618546594220930039685574009498753826907711143617178875027427319372608417764261740662749509586806903246524940843099192190342366528117146469549073583752660133308319889093022601483096002318790166190448785117572,
   -0.9988201506066353793618312727041106551236809978645019641129491773028411355385517455006536893244313855312558723959473955276622730007987825441629353995262625048200363482479065491963504456559829345413107924216032112109320147907388167881278693574170881261546964841685207356249073324736131051128,
   0.9988201506066353793618312727041106551236809978645019641129491773028411355385517455006536893244313855312558723959473955276622730007987825441629353995262625048200363482479065491963504456559829345413107924216032112109320147907388167881278693574170881261546964841685207356249073324736131051128};
-#elif LEGENDRE_GAUSS_N == 5
-constexpr std::array<double, 50> abcissae {
+constexpr std::array<double, 50> abcissae_50 {
   -0.0310983383271888761123289896659491942472962229599980429747962356620305239606004565028047384756036743609342213054916932164258131193040411751026920689241449011097193178455222668065986763613933471614816223861172742872735315854546459495291942313151871872131180410409964578036057942486779145999,
   0.0310983383271888761123289896659491942472962229599980429747962356620305239606004565028047384756036743609342213054916932164258131193040411751026920689241449011097193178455222668065986763613933471614816223861172742872735315854546459495291942313151871872131180410409964578036057942486779145999,
   -0.0931747015600861408544503776396003478856713839221386146828891556461802516674295107179672198298784688901653049792063891285161907411935710988161659353070912475552745379285159612966725856043762887770393250006529115742102585653286033650783364904729767419897102113013850780637334748895180766148,
@@ -1393,8 +1342,7 @@ constexpr std::array<double, 50> abcissae {
   0.9940319694320907125851082004206947281574779710683235903365247891159333102441986200847502032997488182597606600945459419958549215257107600909497912431076196464989212967891293626057814097833081516374703513635326134819095701676989809941280809053034462502697330311898546802092693406276002055604,
   -0.9988664044200710501854594449742185059962435129040785251770386176575391083082719606000817676304540908816211142125746246395146062751602721269012718747075215374285691593278562767853983187135230076747980429953846819229059201451936042829796424039633265927034501611175851432195329432234117877341,
   0.9988664044200710501854594449742185059962435129040785251770386176575391083082719606000817676304540908816211142125746246395146062751602721269012718747075215374285691593278562767853983187135230076747980429953846819229059201451936042829796424039633265927034501611175851432195329432234117877341};
-#elif LEGENDRE_GAUSS_N == 51
-constexpr std::array<double, 51> abcissae {
+constexpr std::array<double, 51> abcissae_51 {
   0,
   -0.0609611001505787247341947068432054046970304642695197844329704234558004587361680365679257641051217937367615152895276779484138944332447573092956344730525241209771556173841131981027971035090338142623603156001566803401187172155393607054067724845804338420989922092307187314768134590615916208419,
   0.0609611001505787247341947068432054046970304642695197844329704234558004587361680365679257641051217937367615152895276779484138944332447573092956344730525241209771556173841131981027971035090338142623603156001566803401187172155393607054067724845804338420989922092307187314768134590615916208419,
@@ -1446,8 +1394,7 @@ constexpr std::array<double, 51> abcissae {
   0.9942612604367525746210848979492631282317843902790149973005832565102910983023287850196161825601445421802369810745307262669092900159328037191463718858940015207881741475812363474863695708843845339267588438507362474258313459292663766703794626082883499691032909039310306581334905124310600906241,
   -0.9989099908489034951689958772733856370842499218881887896686032074057180495535286101942858691443030606573401691529812813980006331127780457926399031210924826484795205486389583128140434191633722461912193977026032384984325437727606442928386275124443407506933253524478626630379201815342355635966,
   0.9989099908489034951689958772733856370842499218881887896686032074057180495535286101942858691443030606573401691529812813980006331127780457926399031210924826484795205486389583128140434191633722461912193977026032384984325437727606442928386275124443407506933253524478626630379201815342355635966};
-#elif LEGENDRE_GAUSS_N == 52
-constexpr std::array<double, 52> abcissae {
+constexpr std::array<double, 52> abcissae_52 {
   -0.0299141097973387660436807760707999268188436082499469816198575393911517137319610109736968891544016864996756954564644313854005317400236883290353731826588953706871221729792605901617969176115208644136170912365984784870060830748025992405337124861570163299256900914194825018126349384495057638983,
   0.0299141097973387660436807760707999268188436082499469816198575393911517137319610109736968891544016864996756954564644313854005317400236883290353731826588953706871221729792605901617969176115208644136170912365984784870060830748025992405337124861570163299256900914194825018126349384495057638983,
   -0.089635244648900565488854691122399303169851287190198420484102629430721031214167831380425953528138253651560466954193833250331631914232348549155236316207895255898550402909016020938220462222387486313623225410785857809529142799861001603853546950916907734242858269918903728118358556301133946567,
@@ -1500,8 +1447,7 @@ constexpr std::array<double, 52> abcissae {
   0.9944775909292160292450432717995717066319117760978821714588562965582496724889117684595945848388872207608064637522839555990387386391547113610797392362994406392702876415206034534045027541633644527082297989396176334942077833033512347164564241714831077584977068833493732570597168945644181266835,
   -0.9989511111039502780909614407165925612780132611153575616799248405004389142979138086614943179988118999109017969675859857247886657044810387096937913358683202232307488277618099196923762324849887121912705956573496557912028345236155598481581369751215416103969755792140242786150790988630208755036,
   0.9989511111039502780909614407165925612780132611153575616799248405004389142979138086614943179988118999109017969675859857247886657044810387096937913358683202232307488277618099196923762324849887121912705956573496557912028345236155598481581369751215416103969755792140242786150790988630208755036};
-#elif LEGENDRE_GAUSS_N == 53
-constexpr std::array<double, 53> abcissae {
+constexpr std::array<double, 53> abcissae_53 {
   0,
   -0.058685054300259465022711945833231537735591283902644238257778180377457643100509915496053803689901753941032900219838882066372727596345088421707474569026626276770468550843442878220377136276746059484049803148874991375787878626662263473142919977124686833280837010557755779806797063176279900669,
   0.058685054300259465022711945833231537735591283902644238257778180377457643100509915496053803689901753941032900219838882066372727596345088421707474569026626276770468550843442878220377136276746059484049803148874991375787878626662263473142919977124686833280837010557755779806797063176279900669,
@@ -1555,8 +1501,7 @@ constexpr std::array<double, 53> abcissae {
   0.9946819193080070786360358934839939041828265943879751608307344316426607505947217363136304840337738955476940069285049717654650701192078259740888457089364436795241263478654514390370197561546641194081142449828045173761992234735569999503577307350997643922273786447579982398896167007812256546409,
   -0.9989899477763282271210542670321995225873095156517325443483174931272573645997735493435531983834570110916868237803440958440437558114903141839278427643794619152166417961849104471903752215115053387241939587952592301050891995768105652252545695960042138172852684835514361027508683634021823672569,
   0.9989899477763282271210542670321995225873095156517325443483174931272573645997735493435531983834570110916868237803440958440437558114903141839278427643794619152166417961849104471903752215115053387241939587952592301050891995768105652252545695960042138172852684835514361027508683634021823672569};
-#elif LEGENDRE_GAUSS_N == 54
-constexpr std::array<double, 54> abcissae {
+constexpr std::array<double, 54> abcissae_54 {
   -0.0288167481993417776562358475002270529894545421779078483714952390129652365407405366858556871748171926496496071872247970998881176939607801638422365063602668370859844259548146952907682698124540208294834163854559144912881731816552768958409195528139819142180133073355590766502434565354628108016,
   0.0288167481993417776562358475002270529894545421779078483714952390129652365407405366858556871748171926496496071872247970998881176939607801638422365063602668370859844259548146952907682698124540208294834163854559144912881731816552768958409195528139819142180133073355590766502434565354628108016,
   -0.086354518263248215285443177768749636369401537487063587948029992247873907240155628310881822615009050336866377601582800793691334120745812314943968361740098864315690201311913124849152775154633577156340827383479510754851992213078873408110661496471360651404204818049368848231566038212855238244,
@@ -1611,8 +1556,7 @@ constexpr std::array<double, 54> abcissae {
   0.9948751170183388849188899959487026594841267588869998286161566818501447994477453083057313754407452886739446075414759355964378257763966273430379133534426628676653093648763513132729944970226341336732504969551876656492880721216392872525355999689223000153544912808085752136006391147062384087059,
   -0.9990266668673409838510711069839584931980427857969603316816502147540906374057918346046850134848377376581717479971531441519755875413658689377073341320463230391024559918972349759638043264878061762230940022411704623326189890763845167124094193145335146277538524147673502157105307227153789134925,
   0.9990266668673409838510711069839584931980427857969603316816502147540906374057918346046850134848377376581717479971531441519755875413658689377073341320463230391024559918972349759638043264878061762230940022411704623326189890763845167124094193145335146277538524147673502157105307227153789134925};
-#elif LEGENDRE_GAUSS_N == 55
-constexpr std::array<double, 55> abcissae {
+constexpr std::array<double, 55> abcissae_55 {
   0,
   -0.0565727538183367763273376108931084341626757424523121836631944679258776663528793063452580839705034426916904530515825296603365980112547320747107457833414217586472688548863910443250774686862242546290798801716520944431462646958464199967518421470624505580174166846863615995648497701500817322445,
   0.0565727538183367763273376108931084341626757424523121836631944679258776663528793063452580839705034426916904530515825296603365980112547320747107457833414217586472688548863910443250774686862242546290798801716520944431462646958464199967518421470624505580174166846863615995648497701500817322445,
@@ -1668,8 +1612,7 @@ constexpr std::array<double, 55> abcissae {
   0.9950579778474118750431891165062023715941007464053922499863500604135379793003146181483954395963544156262095519928232982897835392448765202094245176556084834965658519709143363986903196034081089303108064733647670908055335728149974035039160910086477502175619477511316518058531876679866630143813,
   -0.9990614195648185414794318395193844231555412789294201573324016847109725056702255333270819761330941407684081915340420263134508274442455284498053688765393311148151442033601406752276120403214355242309628572454532238848350924998302477390540563529197647102823550954122018007507128287478563724403,
   0.9990614195648185414794318395193844231555412789294201573324016847109725056702255333270819761330941407684081915340420263134508274442455284498053688765393311148151442033601406752276120403214355242309628572454532238848350924998302477390540563529197647102823550954122018007507128287478563724403};
-#elif LEGENDRE_GAUSS_N == 56
-constexpr std::array<double, 56> abcissae {
+constexpr std::array<double, 56> abcissae_56 {
   -0.0277970352872754370940611967749205218883766031467744877612491558666721293659306312265141126161825998688139837133476641395046783479025639257912184262133613461334964811341311597633393260081482816349016526161842376963322426312617901364084714920659656786539511577498017113521148243331215965974,
   0.0277970352872754370940611967749205218883766031467744877612491558666721293659306312265141126161825998688139837133476641395046783479025639257912184262133613461334964811341311597633393260081482816349016526161842376963322426312617901364084714920659656786539511577498017113521148243331215965974,
   -0.0833051868224353744402873554406624481839874141890305458910885742003799276870593073017529527471618537373216465331861334439596599867228016141630452931841436772837614761899633432622639815878848561944703920208451855162179629107806832781987847703916611525793101525933093966815781247563460565496,
@@ -1726,8 +1669,7 @@ constexpr std::array<double, 56> abcissae {
   0.9952312260810697472163087600989409455485384552339903745338542327254671690294919455227570044907030560201368385309471688664481358789119706927198595506375287902149866985400639639718183879522109592608679477593308152253789923618549051476705278348007343562752521902605218182215255110688191908762,
   -0.999094343801465584353153825090904262176018978459756369772157258474555952732056785168527429295554371833863532796284797843361358450966674588755867976733652576926594859109434628033566599070307299060174106072838152635367789547594166676233205206477576792681264194087165152527887147796005645076,
   0.999094343801465584353153825090904262176018978459756369772157258474555952732056785168527429295554371833863532796284797843361358450966674588755867976733652576926594859109434628033566599070307299060174106072838152635367789547594166676233205206477576792681264194087165152527887147796005645076};
-#elif LEGENDRE_GAUSS_N == 57
-constexpr std::array<double, 57> abcissae {
+constexpr std::array<double, 57> abcissae_57 {
   0,
   -0.0546071510016468242198305597373324454104423343597207807718099846286674038230455439260978590648768841921170691377225791276862033556381051738719975491267401895230946207261662978667168336064265233758235041096608454522532258538499588721210764595093060860784999426567161730380950671230429830636,
   0.0546071510016468242198305597373324454104423343597207807718099846286674038230455439260978590648768841921170691377225791276862033556381051738719975491267401895230946207261662978667168336064265233758235041096608454522532258538499588721210764595093060860784999426567161730380950671230429830636,
@@ -1785,8 +1727,7 @@ constexpr std::array<double, 57> abcissae {
   0.9953955236784303111351250273624190059750688689134139640034917565022399815809592478326855297722206542328388788819601625214272385252826873160098152703112558160095900287306284339258104764704330274130026965945336204829720257900775483706171023957225069069253335385428758304141531188818843288913,
   -0.9991255656252628505720098495542498849991275860070135753660525242874635296889841340857915450747682548481565744621726587691422167680778471881572252754817451450581514728015832390524924407847446662485804461394976244674246589654709052510893087982816412749630716782906314190666504073802602305119,
   0.9991255656252628505720098495542498849991275860070135753660525242874635296889841340857915450747682548481565744621726587691422167680778471881572252754817451450581514728015832390524924407847446662485804461394976244674246589654709052510893087982816412749630716782906314190666504073802602305119};
-#elif LEGENDRE_GAUSS_N == 58
-constexpr std::array<double, 58> abcissae {
+constexpr std::array<double, 58> abcissae_58 {
   -0.0268470123659423558033386895173799858434211766318936099778288245643516358900352592842625553785442594646762967376648911114286395753087741994756448125271490479482360386891861430622557306492967818096180053647711246123130268725019939801300463385848901659283155345576690988620964256552569598506,
   0.0268470123659423558033386895173799858434211766318936099778288245643516358900352592842625553785442594646762967376648911114286395753087741994756448125271490479482360386891861430622557306492967818096180053647711246123130268725019939801300463385848901659283155345576690988620964256552569598506,
   -0.0804636302141427293098477923805031948893348968318648099211817751369509710733316603425401822100943774682232982517958785133120938588393356025004132603499804677411931045470948366310758667449149827547645057119081553466244732937509213943500627629517107171494926520592821028108454636957389935135,
@@ -1845,8 +1786,7 @@ constexpr std::array<double, 58> abcissae {
   0.9955514765972909026027715261799461412769672802429748808659519140416855484176442379762677455735980420562679958695596446125290019813761444823139138749923925809207868883429770900753766939861159066461282564917520634677066319871037360764868108759956647400644824799245764382023824162697291892119,
   -0.999155200407386606442737044184605761045813585872715630711818611208151864967754857400691892925817647325212268790311654235444679092898614702683856045061108965111137175659843188939271306044652679474195889427166596342817720696481478280110711055038985994482293471184350282419665490630749495513,
   0.999155200407386606442737044184605761045813585872715630711818611208151864967754857400691892925817647325212268790311654235444679092898614702683856045061108965111137175659843188939271306044652679474195889427166596342817720696481478280110711055038985994482293471184350282419665490630749495513};
-#elif LEGENDRE_GAUSS_N == 59
-constexpr std::array<double, 59> abcissae {
+constexpr std::array<double, 59> abcissae_59 {
   0,
   -0.0527734840883100039516803286033385378247007695091781053140224260048462251140739466684856063027492181778556563756026746500498456728055781874181650830386331087004468308766442142735913691836456065629835127622817846235503775430445712041880911426049717481600940204148724446373463660655599852969,
   0.0527734840883100039516803286033385378247007695091781053140224260048462251140739466684856063027492181778556563756026746500498456728055781874181650830386331087004468308766442142735913691836456065629835127622817846235503775430445712041880911426049717481600940204148724446373463660655599852969,
@@ -1906,8 +1846,7 @@ constexpr std::array<double, 59> abcissae {
   0.995699640383245964687201823433448307661855776908591227007984199985894847788944776887921233427740077039992301977563502721309898687431227822295113276399152490705543130230703151909821114312062495459476425817441471193962221363511684854499612520661114596513188992852307170123719795685263746573,
   -0.999183353909294683756424019504678184974225970330022708551072301271655190230774371953085513404573092350739636439422769873242969230142526196478475804475796098595883665650877448929193428884721767218922669275568859267385363976473249932986069511421294361973818445506490201432768286051059824741,
   0.999183353909294683756424019504678184974225970330022708551072301271655190230774371953085513404573092350739636439422769873242969230142526196478475804475796098595883665650877448929193428884721767218922669275568859267385363976473249932986069511421294361973818445506490201432768286051059824741};
-#elif LEGENDRE_GAUSS_N == 60
-constexpr std::array<double, 60> abcissae {
+constexpr std::array<double, 60> abcissae_60 {
   -0.0259597723012477985891703854003448256603147607172752254926166408308344675966491065573984727357510429285490241485151566763085721550656737356150205335429530519854733445081395975402899734761478488819958887295171637258185006915982421778460846856967803603456406792754027878206555935493848231527,
   0.0259597723012477985891703854003448256603147607172752254926166408308344675966491065573984727357510429285490241485151566763085721550656737356150205335429530519854733445081395975402899734761478488819958887295171637258185006915982421778460846856967803603456406792754027878206555935493848231527,
   -0.0778093339495365694192855070822252875775947828977239550142187612324959393986196072983471240897349749909202078569768437791837467751614220306955674495601571003146510567351141039159648327666678449844869136981310266145668244638287666238771690819151947081038602689483233629465043794762449169488,
@@ -1968,8 +1907,7 @@ constexpr std::array<double, 60> abcissae {
   0.9958405251188381738767467133774406527748902949771391019074832413130808430977719324853149350005814606218746052817197852980761520253131108198387965031383267657721277610843401935361720731458403548387297914189782600380877704396241358652640406768388726580349022692723169481773500350278484884245,
   -0.9992101232274360220342295857976492663987989787113256706920228890827049544234109387465581201888208671309656987198097354483746396863650346766088838875713461461700717248610073410865203825288508482850407859484825716152168951216208896937100115460768524993087733112539642374148661740855993771203,
   0.9992101232274360220342295857976492663987989787113256706920228890827049544234109387465581201888208671309656987198097354483746396863650346766088838875713461461700717248610073410865203825288508482850407859484825716152168951216208896937100115460768524993087733112539642374148661740855993771203};
-#elif LEGENDRE_GAUSS_N == 61
-constexpr std::array<double, 61> abcissae {
+constexpr std::array<double, 61> abcissae_61 {
   0,
   -0.0510589067079743493668875006189007980701842540412565384683917415178170335886157867818335541304494855657807370775833290356042992636946823332312115950879332937301021267671239858747967524341549703706176569205963441435927091438888817667010948847153196057896655497296546199150000493439895660647,
   0.0510589067079743493668875006189007980701842540412565384683917415178170335886157867818335541304494855657807370775833290356042992636946823332312115950879332937301021267671239858747967524341549703706176569205963441435927091438888817667010948847153196057896655497296546199150000493439895660647,
@@ -2031,8 +1969,7 @@ constexpr std::array<double, 61> abcissae {
   0.9959745998151202342680127607122882762868488647891317254356288675552164473817197535276900991809220574256619818321237729860588995899547541709228906585598328502188188670023754511835196519266470457762763826852313150436155388910216227940681703756759825185020672925360913041608805126513352152113,
   -0.9992355976313634717318622595691308628534420485030008313876371802574113071878113429979081910450202994607976599246378056211138899925597625359684185080206388458501684271815577999138838348765768262437367054357069856438998247789672615517152201207035676639344062123313221908252692760005540009258,
   0.9992355976313634717318622595691308628534420485030008313876371802574113071878113429979081910450202994607976599246378056211138899925597625359684185080206388458501684271815577999138838348765768262437367054357069856438998247789672615517152201207035676639344062123313221908252692760005540009258};
-#elif LEGENDRE_GAUSS_N == 62
-constexpr std::array<double, 62> abcissae {
+constexpr std::array<double, 62> abcissae_62 {
   -0.0251292914218206147270882759991469623145049180248149489791202711032230414012127703324892744635800403874841402562327838134852770215228622059785693289477536472106628464778326991269399127060143904637603740962593754110381951959832652674322740614820063026066748212540478789973768331841841793262,
   0.0251292914218206147270882759991469623145049180248149489791202711032230414012127703324892744635800403874841402562327838134852770215228622059785693289477536472106628464778326991269399127060143904637603740962593754110381951959832652674322740614820063026066748212540478789973768331841841793262,
   -0.0753243954962343327638269391178708775768458123144207998372459877598951711533372902011535812454326324271708959396886816223807775623747927500247080638560090025496942638123864504775531126765040047477236057625265781552894550104827460522702898098923978110735537353993468290682461807258124410302,
@@ -2095,8 +2032,7 @@ constexpr std::array<double, 62> abcissae {
   0.9961022963162671328851484304761714926321402172798419577342691570905568082572140520774915737550910465873564928764263929458081560838484027927687263877970351334210868056321911349036024502239949064229530617573135939734894015278889778866235707009296489067233591836795121829695974226727731526384,
   -0.9992598593087770296984084650357989380196344605102218530613955142341871932840234122663556604967574723961623483801986301111519608758351713045451217383581390588662467115910316876004867084529839001942282283290199689376350919201683097447655469856249686245858730355465258285320592874425507944264,
   0.9992598593087770296984084650357989380196344605102218530613955142341871932840234122663556604967574723961623483801986301111519608758351713045451217383581390588662467115910316876004867084529839001942282283290199689376350919201683097447655469856249686245858730355465258285320592874425507944264};
-#elif LEGENDRE_GAUSS_N == 63
-constexpr std::array<double, 63> abcissae {
+constexpr std::array<double, 63> abcissae_63 {
   0,
   -0.0494521871161596272342338180518076098977554568999159460631630120033742469913091244898871942935751356619268721457912205232000485517698224895560650951253633497295705871667019582156353562903475288561883941859505074444229352268393141725081325702191949413301731852530026351008093516641915185241,
   0.0494521871161596272342338180518076098977554568999159460631630120033742469913091244898871942935751356619268721457912205232000485517698224895560650951253633497295705871667019582156353562903475288561883941859505074444229352268393141725081325702191949413301731852530026351008093516641915185241,
@@ -2160,8 +2096,7 @@ constexpr std::array<double, 63> abcissae {
   0.996224012777970108602193361146311353293076971857523297876321666391617065398344319527897601678577717804136698136240438085416256473877690211261799494202848821046946654652723633738092028118393922878608534146504522588820328189615703557065387695749910376907934683590609816440364799354668436117,
   -0.9992829840291237803789361409289444610727967181862428131517561527112684001786400492708065740608013881246916812160968177155057342587520618965574590448349639299326883409795484594923460693906908334836038647651372160064759508404251806548685404384194895816645682089254271180674480510382469219266,
   0.9992829840291237803789361409289444610727967181862428131517561527112684001786400492708065740608013881246916812160968177155057342587520618965574590448349639299326883409795484594923460693906908334836038647651372160064759508404251806548685404384194895816645682089254271180674480510382469219266};
-#elif LEGENDRE_GAUSS_N == 64
-constexpr std::array<double, 64> abcissae {
+constexpr std::array<double, 64> abcissae_64 {
   -0.0243502926634244325089558428537156614268871093149758091634531663960566965166295288529853061657116894882370493013671717560479926679408068852617342586968190919443025679363843727751902756254975073084367002129407854253246662805532069172532219089321005870178809284335033318073251039701073379759,
   0.0243502926634244325089558428537156614268871093149758091634531663960566965166295288529853061657116894882370493013671717560479926679408068852617342586968190919443025679363843727751902756254975073084367002129407854253246662805532069172532219089321005870178809284335033318073251039701073379759,
   -0.0729931217877990394495429419403374932441261816687788533563163323377395217254429050181833064967505478802134768007678458612956459126148837496307967995621683597067400860540057918571357609346700883624064782909888895547912499697295335516804810990011835717296819569741981551097569810739977931249,
@@ -2226,43 +2161,35 @@ constexpr std::array<double, 64> abcissae {
   0.9963401167719552793469245006763991232098575063402266121352522199507030568202208530946066801021703916301511794658310735397567341036554686814952726523955953805437164277655915410358813984246580862850974195805395101678543649116458555272523253307828290553873260588621490898443701779725568118502,
   -0.9993050417357721394569056243456363119697121916756087760628072954617646543505331997843242376462639434945376776512170265314011232493020401570891594274831367800115383317335285468800574240152992751785027563437707875403545865305271045717258142571193695943317890367167086616955235477529427992282,
   0.9993050417357721394569056243456363119697121916756087760628072954617646543505331997843242376462639434945376776512170265314011232493020401570891594274831367800115383317335285468800574240152992751785027563437707875403545865305271045717258142571193695943317890367167086616955235477529427992282};
-#endif // ABCISSAE
 
-#if LEGENDRE_GAUSS_N == 1
-constexpr std::array<double, 1> weights {
+constexpr std::array<double, 1> weights_1 {
   2};
-#elif LEGENDRE_GAUSS_N == 2
-constexpr std::array<double, 2> weights {
+constexpr std::array<double, 2> weights_2 {
   1.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000,
   1.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000};
-#elif LEGENDRE_GAUSS_N == 3
-constexpr std::array<double, 3> weights {
+constexpr std::array<double, 3> weights_3 {
   0.8888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888889,
   0.5555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555556,
   0.5555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555556};
-#elif LEGENDRE_GAUSS_N == 4
-constexpr std::array<double, 4> weights {
+constexpr std::array<double, 4> weights_4 {
   0.6521451548625461426269360507780005927646513041661064595074706804812481325340896482780162322677418404902018960952364978455755577496740182191429757016783303751407135229556360801973666260481564013273531860737119707353160256000107787211587578617532049337456560923057986412084590467808124974086,
   0.6521451548625461426269360507780005927646513041661064595074706804812481325340896482780162322677418404902018960952364978455755577496740182191429757016783303751407135229556360801973666260481564013273531860737119707353160256000107787211587578617532049337456560923057986412084590467808124974086,
   0.3478548451374538573730639492219994072353486958338935404925293195187518674659103517219837677322581595097981039047635021544244422503259817808570242983216696248592864770443639198026333739518435986726468139262880292646839743999892212788412421382467950662543439076942013587915409532191875025701,
   0.3478548451374538573730639492219994072353486958338935404925293195187518674659103517219837677322581595097981039047635021544244422503259817808570242983216696248592864770443639198026333739518435986726468139262880292646839743999892212788412421382467950662543439076942013587915409532191875025701};
-#elif LEGENDRE_GAUSS_N == 5
-constexpr std::array<double, 5> weights {
+constexpr std::array<double, 5> weights_5 {
   0.5688888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888888889,
   0.4786286704993664680412915148356381929122955533431415399727276673338382671525124569755621250616041107794464209474122299742927901670531874220236019762755381069981020199559708433435017355341690324695622104863536721598859262913644828482640505637133513606531929893286127565185389732581634388813,
   0.4786286704993664680412915148356381929122955533431415399727276673338382671525124569755621250616041107794464209474122299742927901670531874220236019762755381069981020199559708433435017355341690324695622104863536721598859262913644828482640505637133513606531929893286127565185389732581634388813,
   0.2369268850561890875142640407199173626432600022124140155828278882217172884030430985799934304939514447761091346081433255812627653885023681335319535792800174485574535355995847122120538200213865230859933450692018833956696292641910727072915049918422041949023625662269427990370165822973921166843,
   0.2369268850561890875142640407199173626432600022124140155828278882217172884030430985799934304939514447761091346081433255812627653885023681335319535792800174485574535355995847122120538200213865230859933450692018833956696292641910727072915049918422041949023625662269427990370165822973921166843};
-#elif LEGENDRE_GAUSS_N == 6
-constexpr std::array<double, 6> weights {
+constexpr std::array<double, 6> weights_6 {
   0.3607615730481386075698335138377161116615218927467454822897392402371400378372617183209622019888193479431172091403707985898798902783643210707767872114085818922114502722525757771126000732368828591631602895111800517408136855470744824724861011832599314498172164024255867775267681999309503106873150514997832,
   0.3607615730481386075698335138377161116615218927467454822897392402371400378372617183209622019888193479431172091403707985898798902783643210707767872114085818922114502722525757771126000732368828591631602895111800517408136855470744824724861011832599314498172164024255867775267681999309503106873150514997832,
   0.4679139345726910473898703439895509948116556057692105353116253199639142016203981270311100925847919823047662687897547971009283625541735029545935635592733866593364825926382559018030281273563502536241704619318259000997569870959005334740800746343768244318081732063691741034162617653462927888917150514997832,
   0.4679139345726910473898703439895509948116556057692105353116253199639142016203981270311100925847919823047662687897547971009283625541735029545935635592733866593364825926382559018030281273563502536241704619318259000997569870959005334740800746343768244318081732063691741034162617653462927888917150514997832,
   0.1713244923791703450402961421727328935268225014840439823986354397989457605423401546479277054263886697521165220698744043091917471674621759746296492293180314484520671351091683210843717994067668872126692485569940481594293273570249840534338241823632441183746103912052391190442197035702977497812150514997832,
   0.1713244923791703450402961421727328935268225014840439823986354397989457605423401546479277054263886697521165220698744043091917471674621759746296492293180314484520671351091683210843717994067668872126692485569940481594293273570249840534338241823632441183746103912052391190442197035702977497812150514997832};
-#elif LEGENDRE_GAUSS_N == 7
-constexpr std::array<double, 7> weights {
+constexpr std::array<double, 7> weights_7 {
   0.4179591836734693877551020408163265306122448979591836734693877551020408163265306122448979591836734693877551020408163265306122448979591836734693877551020408163265306122448979591836734693877551020408163265306122448979591836734693877551020408163265306122448979591836734693877551020408163265306,
   0.3818300505051189449503697754889751338783650835338627347510834510307055464341297083486846593440448014503146717645853573344928956776383837562443187566373816994263513750309425122069048082192405967657155458166140211350441276674773890998286086501179973611850420964132316867109449892362441359044150514997832,
   0.3818300505051189449503697754889751338783650835338627347510834510307055464341297083486846593440448014503146717645853573344928956776383837562443187566373816994263513750309425122069048082192405967657155458166140211350441276674773890998286086501179973611850420964132316867109449892362441359044150514997832,
@@ -2270,8 +2197,7 @@ constexpr std::array<double, 7> weights {
   0.2797053914892766679014677714237795824869250652265987645370140326936188104305626768132409429011976187663233752133720515191356369795631199443713526578123368545563592025336909192643194833502493348267909279642862302108156020621692804889667628308214167200738365553989662119973317061306305537859150514997832,
   0.1294849661688696932706114326790820183285874022599466639772086387246552349720423087156254181629208450894844020016344278810653448938189044626496347079992610378540241163129175889369389737366325173870853629537936262051606784336186365336536081108973206126186723685959653665979209749176350897029150514997832,
   0.1294849661688696932706114326790820183285874022599466639772086387246552349720423087156254181629208450894844020016344278810653448938189044626496347079992610378540241163129175889369389737366325173870853629537936262051606784336186365336536081108973206126186723685959653665979209749176350897029150514997832};
-#elif LEGENDRE_GAUSS_N == 8
-constexpr std::array<double, 8> weights {
+constexpr std::array<double, 8> weights_8 {
   0.3626837833783619829651504492771956121941460398943305405248230675666867347239066773243660420848285095502587699262967065529258215569895173844995576007862076842778350382862546305771007553373269714714894268328780431822779077846722965535548199601402487767505928976560993309027632737537826127502150514997832,
   0.3626837833783619829651504492771956121941460398943305405248230675666867347239066773243660420848285095502587699262967065529258215569895173844995576007862076842778350382862546305771007553373269714714894268328780431822779077846722965535548199601402487767505928976560993309027632737537826127502150514997832,
   0.3137066458778872873379622019866013132603289990027349376902639450749562719421734969616980762339285560494275746410778086162472468322655616056890624276469758994622503118776562559463287222021520431626467794721603822601295276898652509723185157998353156062419751736972560423953923732838789657919150514997832,
@@ -2280,8 +2206,7 @@ constexpr std::array<double, 8> weights {
   0.2223810344533744705443559944262408844301308700512495647259092892936168145704490408536531423771979278421592661012122181231114375798525722419381826674532090577908613289536840402789398648876004385697202157482063253247195590228631570651319965589733545440605952819880671616779621183704306688233150514997832,
   0.1012285362903762591525313543099621901153940910516849570590036980647401787634707848602827393040450065581543893314132667077154940308923487678731973041136073584690533208824050731976306575729205467961435779467552492328730055025992954089946676810510810729468366466585774650346143712142008566866150514997832,
   0.1012285362903762591525313543099621901153940910516849570590036980647401787634707848602827393040450065581543893314132667077154940308923487678731973041136073584690533208824050731976306575729205467961435779467552492328730055025992954089946676810510810729468366466585774650346143712142008566866150514997832};
-#elif LEGENDRE_GAUSS_N == 9
-constexpr std::array<double, 9> weights {
+constexpr std::array<double, 9> weights_9 {
   0.3302393550012597631645250692869740488788107835726883345930964978584026203073822121441169060216679264298311917359536407155454774502393550012597631645250692869740488788107835726883345930964978584026203073822121441169060216679264298311917359536407155454774502393550012597631645250692869740489,
   0.1806481606948574040584720312429128095143378217320404844983359064713572905449462697645949773031997041476074679602577937226796268460630127231790100804745577374812973964868278705556370432288860477148539230329025541102198218481213990057413494800065234875808239968200871271576666111786816983312150514997832,
   0.1806481606948574040584720312429128095143378217320404844983359064713572905449462697645949773031997041476074679602577937226796268460630127231790100804745577374812973964868278705556370432288860477148539230329025541102198218481213990057413494800065234875808239968200871271576666111786816983312150514997832,
@@ -2291,8 +2216,7 @@ constexpr std::array<double, 9> weights {
   0.3123470770400028400686304065844436655987548612619046455540111655991438973240193165701219218880063538522954773181646973116391818098875271459600370901478405885572589090757645984059641355722376816546561522245422024969266380802745127735793790292136245228820749357799614002097074181144513901973150514997832,
   0.2606106964029354623187428694186328497718402044372999519399970021196108156688912446476460930950174018273873855356376505133184038238358268707029298682703161767070852826824482373696733967124934731275123758942032745317892944979452416330800688391928576238230768124473665313152599422632809847998150514997832,
   0.2606106964029354623187428694186328497718402044372999519399970021196108156688912446476460930950174018273873855356376505133184038238358268707029298682703161767070852826824482373696733967124934731275123758942032745317892944979452416330800688391928576238230768124473665313152599422632809847998150514997832};
-#elif LEGENDRE_GAUSS_N == 10
-constexpr std::array<double, 10> weights {
+constexpr std::array<double, 10> weights_10 {
   0.295524224714752870173892994651338329421046717026853601354308029755995938217152329270356595793754216722717164401252558386818490789552005826001936342494186966609562718648884168043231305061535867409083051270663865287483901746874726597515954450775158914556548308329986393605934912382356670244,
   0.295524224714752870173892994651338329421046717026853601354308029755995938217152329270356595793754216722717164401252558386818490789552005826001936342494186966609562718648884168043231305061535867409083051270663865287483901746874726597515954450775158914556548308329986393605934912382356670244,
   0.2692667193099963550912269215694693528597599384608837958005632762421534323191792767642266367092527607555958114503686983086929234693811452415564658846634423711656014432259960141729044528030344411297902977067142537534806284608399276575006911686749842814086288868533208042150419508881916391898,
@@ -2303,8 +2227,7 @@ constexpr std::array<double, 10> weights {
   0.1494513491505805931457763396576973324025566396694273678354772687532386547266300109459472646347319519140057525610454363382344517067454976014713716011937109528798134828865118770953566439639333773939909201690204649083815618779157522578300343427785361756927642128792412282970150172590842897331,
   0.066671344308688137593568809893331792857864834320158145128694881613412064084087101776785509685058877821090054714520419331487507126254403762139304987316994041634495363706400187011242315504393526242450629832718198718647480566044117862086478449236378557180717569208295026105115288152794421677,
   0.066671344308688137593568809893331792857864834320158145128694881613412064084087101776785509685058877821090054714520419331487507126254403762139304987316994041634495363706400187011242315504393526242450629832718198718647480566044117862086478449236378557180717569208295026105115288152794421677};
-#elif LEGENDRE_GAUSS_N == 11
-constexpr std::array<double, 11> weights {
+constexpr std::array<double, 11> weights_11 {
   0.2729250867779006307144835283363421891560419698947837475976004114532253060391588530116668644807172945701084229222757361285499813638341776869915398053926192454330982469510608038746566885095023623162151300679439207577735716263854791993320131848270376408904547432685960824488963017101545240073,
   0.2628045445102466621806888698905091953727646776031445563800553714855128033395452535524169970170267059591323352348905685930815659959388220486516662277122153406007564563422288846814246265117197586291110715875175614041126916826846274452615523702086591000201133611607179097990732517786141292028,
   0.2628045445102466621806888698905091953727646776031445563800553714855128033395452535524169970170267059591323352348905685930815659959388220486516662277122153406007564563422288846814246265117197586291110715875175614041126916826846274452615523702086591000201133611607179097990732517786141292028,
@@ -2316,8 +2239,7 @@ constexpr std::array<double, 11> weights {
   0.1255803694649046246346942992239401001976157913954035006639340108179145751324712776346876417140545303978650585450845219359841068839377506073290884347363756769005925474627589346055152226465992230909984623296951248837188959879470592809528962736823949327704509072540524563398665677063470369886,
   0.0556685671161736664827537204425485787285156256968981483483842856741554072807375438836912220723188458102963210282419741638055041804016622427741273933989226320452792795289103667005518691583056421625103412886069481254986095193969566623343095934357856658000335256976480404119666482269782141718,
   0.0556685671161736664827537204425485787285156256968981483483842856741554072807375438836912220723188458102963210282419741638055041804016622427741273933989226320452792795289103667005518691583056421625103412886069481254986095193969566623343095934357856658000335256976480404119666482269782141718};
-#elif LEGENDRE_GAUSS_N == 12
-constexpr std::array<double, 12> weights {
+constexpr std::array<double, 12> weights_12 {
   0.2491470458134027850005624360429512108304609025696188313953510031162794274572880430311568006180423530648334761178771858330585110736036496880396421037700854294150273722109172825701968430164659192402161982079625520732434085776613788579662540329347837170742904111565650371846972323325015720931,
   0.2491470458134027850005624360429512108304609025696188313953510031162794274572880430311568006180423530648334761178771858330585110736036496880396421037700854294150273722109172825701968430164659192402161982079625520732434085776613788579662540329347837170742904111565650371846972323325015720931,
   0.2334925365383548087608498989248780562594099721997548747305234978214920000794116752806790265085636904667387564397088688338985427884089160966197503884738075353324814517948875038881216279280304248959830878229357729079164423103001879530654707315375809270840669989018891281956753131165193423269,
@@ -2330,8 +2252,7 @@ constexpr std::array<double, 12> weights {
   0.1069393259953184309602547181939962242145701734703248800051260421028189936274975765405373180963164574135763593331411441611703305169635508448480086523269196005011439044764920482935551535857607910705249218071033795470424895712830930967806467598358517298903536137451828089012822811396588037254,
   0.0471753363865118271946159614850170603170290739948470895605053470038097211520387106708259070754145360966161016755967385796674804082391329967384636510990980857579796788584959896597568705489452579970026951919317931124539907107094212532123682663180160342232703368882666374567833050364187887189,
   0.0471753363865118271946159614850170603170290739948470895605053470038097211520387106708259070754145360966161016755967385796674804082391329967384636510990980857579796788584959896597568705489452579970026951919317931124539907107094212532123682663180160342232703368882666374567833050364187887189};
-#elif LEGENDRE_GAUSS_N == 13
-constexpr std::array<double, 13> weights {
+constexpr std::array<double, 13> weights_13 {
   0.2325515532308739101945895152688359481566274773067979861186654393447600240807034013827220620427413634206841000047793254586461379668172874966081759288552495345702138908932115725322518529311736104942898149691356484563277770070976864183657390450597243804037010830217623424416631209838003044796,
   0.2262831802628972384120901860397766184347577376155570198649685487715756631204999710418263186663139297211265889107526836426557968078763428902495438151872023237441066027256935875147140517861161869397608640950846733738986712351672898382114993485440591169613748948922640415655895437609919445534,
   0.2262831802628972384120901860397766184347577376155570198649685487715756631204999710418263186663139297211265889107526836426557968078763428902495438151872023237441066027256935875147140517861161869397608640950846733738986712351672898382114993485440591169613748948922640415655895437609919445534,
@@ -2345,8 +2266,7 @@ constexpr std::array<double, 13> weights {
   0.0921214998377284479144217759537971209236839998622368390883915473395937297276329262918978157557319728688464206180281115405280755822061330132575025454931122799528778263378580260096595447239712476272992175052866998048878792306641975965562093757627202951860014882629364182187061210206786185036,
   0.0404840047653158795200215922009860600419865457449888681350466075049944605127927104944208124330531617543255657674600847044473453552393229078708618451618261442454009833802490704966043276332314749616597004151381666755063607687770292544492940217462056927723781927519191887428534879952917444979,
   0.0404840047653158795200215922009860600419865457449888681350466075049944605127927104944208124330531617543255657674600847044473453552393229078708618451618261442454009833802490704966043276332314749616597004151381666755063607687770292544492940217462056927723781927519191887428534879952917444979};
-#elif LEGENDRE_GAUSS_N == 14
-constexpr std::array<double, 14> weights {
+constexpr std::array<double, 14> weights_14 {
   0.215263853463157790195876443316260035274997558054128800219776392543618787353994604001024441410819578237256672332436770992948165976464930189035601908050981428041757802691565082287626417365449192946281203662033345376460522564310634412912654698349487266562730897512393716549425155133887783267,
   0.215263853463157790195876443316260035274997558054128800219776392543618787353994604001024441410819578237256672332436770992948165976464930189035601908050981428041757802691565082287626417365449192946281203662033345376460522564310634412912654698349487266562730897512393716549425155133887783267,
   0.2051984637212956039659240656612180557103390613094194517168972902833671448252497203394318399918908957243692694424494287284534856133850644865918702302140316671417873329934748278391381113256848128254396760209050529765354249731237553251469192851898072394707049964721031773292256965337005468577,
@@ -2361,8 +2281,7 @@ constexpr std::array<double, 14> weights {
   0.0801580871597602098056332770628543095836977853945947652013990654895714744572871698635361908191377559686225015908038847487953091382572604434376755119844740947797387723700536610577178522653954549123135546624971159464576653576521600937489354127710937535198838649279475628473516378736712929573,
   0.0351194603317518630318328761381917806197056092771272765814998901964163228378082705376767969986464636614217324764405511345585478510619843098677334088459571639479324880874445672906474148414770675031860143060108937026176235406760523793904458974659810087587180865408885105556219147609526200925,
   0.0351194603317518630318328761381917806197056092771272765814998901964163228378082705376767969986464636614217324764405511345585478510619843098677334088459571639479324880874445672906474148414770675031860143060108937026176235406760523793904458974659810087587180865408885105556219147609526200925};
-#elif LEGENDRE_GAUSS_N == 15
-constexpr std::array<double, 15> weights {
+constexpr std::array<double, 15> weights_15 {
   0.2025782419255612728806201999675193148386621580094773567967041160514353987547460740933934407127880321353514826708299901773095246288719482192675665869139062612256085449558643031836505029978223451416924610397803870997344190817384290577763771236964710158183351656545129738602932076125549319023,
   0.1984314853271115764561183264438393248186925599575419934847379279291247975334342681333149991648178232076602085488930991764791477591610421132086613599988857531192702426415927231327044667892816045834098228729517385124172569721507734356429605231973280268604684028301488322765670316796303356288,
   0.1984314853271115764561183264438393248186925599575419934847379279291247975334342681333149991648178232076602085488930991764791477591610421132086613599988857531192702426415927231327044667892816045834098228729517385124172569721507734356429605231973280268604684028301488322765670316796303356288,
@@ -2378,8 +2297,7 @@ constexpr std::array<double, 15> weights {
   0.0703660474881081247092674164506673384667080327543307198259072929143870555128742370448404520666939392193554898585950405388046148432772910792956556041537582479070968902376133780797668535183637426522389065978826221602778581837148625124153563760247327246091136423557230784075321996037169475438,
   0.0307532419961172683546283935772044177217481448334340742642282855042371894671171680390387707323994040025169911888594731301931311793307049136572121249488040088053791567453616163473679786846675406619664506995965540924443751786755055481899678620830700956557210823767451729158413495735272185295,
   0.0307532419961172683546283935772044177217481448334340742642282855042371894671171680390387707323994040025169911888594731301931311793307049136572121249488040088053791567453616163473679786846675406619664506995965540924443751786755055481899678620830700956557210823767451729158413495735272185295};
-#elif LEGENDRE_GAUSS_N == 16
-constexpr std::array<double, 16> weights {
+constexpr std::array<double, 16> weights_16 {
   0.1894506104550684962853967232082831051469089883959029750375132452000228907691330063001339778335339522825338056432096423297083652175404007311690388189431844411595815612767118459616173498175974279783368912090196026294264906147293439818164037940618838412163450874403569646465188699526105009401,
   0.1894506104550684962853967232082831051469089883959029750375132452000228907691330063001339778335339522825338056432096423297083652175404007311690388189431844411595815612767118459616173498175974279783368912090196026294264906147293439818164037940618838412163450874403569646465188699526105009401,
   0.1826034150449235888667636679692199393835562236546492824184951443794304649501111749604004251169852753140450247468164720359323414531767503677231287901939855049593288980367779339835260945463293576871039381184643035967488751413022888111613573519788630660749465009519914881317048638180707164801,
@@ -2396,8 +2314,7 @@ constexpr std::array<double, 16> weights {
   0.0622535239386478928628438369943776942749865083529068579013035158195357388870438190612117095368517345326677408437010587484095102733930688584375043469278735539030250578328671232854442125221885072444734914927471878528529881785852210014369332953413853555572557051831454875621973358414449964621,
   0.0271524594117540948517805724560181035122673755667607979906103190738041136642161732493257792290308808998974259954086067547083751974232521958283764526154679805418678763257877173475328975259417904071578049294517404669732770687128254946226155762176028585659082598276568361140612201745491935876,
   0.0271524594117540948517805724560181035122673755667607979906103190738041136642161732493257792290308808998974259954086067547083751974232521958283764526154679805418678763257877173475328975259417904071578049294517404669732770687128254946226155762176028585659082598276568361140612201745491935876};
-#elif LEGENDRE_GAUSS_N == 17
-constexpr std::array<double, 17> weights {
+constexpr std::array<double, 17> weights_17 {
   0.1794464703562065254582656442618856214487803198976685236676686979555967546062802594045284457525042776008649811893857352435682986331876081111851108866780622936808158737325303170069706877766177174957552596061722460122214923353807537674420503241048324569186636761507104543537545368471074829307,
   0.1765627053669926463252709901131972391509244180007481180431444069132090362072826804523346906840866559301006092111631043456274034660130273980983840504934095470315458660285588518049547114140699023340485341657476841937868857687900376505657106556888601202176730417304723831886390079072130629649,
   0.1765627053669926463252709901131972391509244180007481180431444069132090362072826804523346906840866559301006092111631043456274034660130273980983840504934095470315458660285588518049547114140699023340485341657476841937868857687900376505657106556888601202176730417304723831886390079072130629649,
@@ -2415,8 +2332,7 @@ constexpr std::array<double, 17> weights {
   0.055459529373987201129440165358244660512846251953228846993724078710257426003334638373275788744821901102297299483619936822358082783206379864639745886162534575206272618194628448672658150271369557624764374900791878769502590209653421358315740618303892325062804722289534273941957588087316299781,
   0.0241483028685479319601100262875653246916973159450252783111851488302183967055104863595852414675449908519473113756040904963477830807558383713007208876834609499285717924393173191172738861013117628311002381876812143174198567792595740020073117811493886032365375159642595860025385521819350292818,
   0.0241483028685479319601100262875653246916973159450252783111851488302183967055104863595852414675449908519473113756040904963477830807558383713007208876834609499285717924393173191172738861013117628311002381876812143174198567792595740020073117811493886032365375159642595860025385521819350292818};
-#elif LEGENDRE_GAUSS_N == 18
-constexpr std::array<double, 18> weights {
+constexpr std::array<double, 18> weights_18 {
   0.1691423829631435918406564701349866103341058193703438802698751915490594441915546421709209140397781535882236287858096022651991109570105409679724328782921212245564934063159034512433937773326382340213877306682008490401803026464426090514675100961891997919361138887123759382863686530866127972569,
   0.1691423829631435918406564701349866103341058193703438802698751915490594441915546421709209140397781535882236287858096022651991109570105409679724328782921212245564934063159034512433937773326382340213877306682008490401803026464426090514675100961891997919361138887123759382863686530866127972569,
   0.1642764837458327229860537764659275904123389539973529532444969709116484218452080077553637577470604890284648113509545041993644726379185282871113207576557673424148421704789647486570815505590931928740872581565708587404351827700772678358448394118368041141223571486216522533602397578204727788698,
@@ -2435,8 +2351,7 @@ constexpr std::array<double, 18> weights {
   0.0497145488949697964533349462026386416808662461289102022463043078655723432958034162950413709493755363901578109123761072246185991085606677862915057965108447312909911728438022161634770405530539475169791168653216398791251592475094524716122801457301171483506316945948812057997564235047218740689,
   0.0216160135264833103133427102664524693876852314755899454620759901413530902373451219032513030698711967035264924116967392053551181478743988660852695341581009207010816978420860521062185588642790444835684731603087600331123347457553616726010767569443955174785105791766212787985301684570081667535,
   0.0216160135264833103133427102664524693876852314755899454620759901413530902373451219032513030698711967035264924116967392053551181478743988660852695341581009207010816978420860521062185588642790444835684731603087600331123347457553616726010767569443955174785105791766212787985301684570081667535};
-#elif LEGENDRE_GAUSS_N == 19
-constexpr std::array<double, 19> weights {
+constexpr std::array<double, 19> weights_19 {
   0.1610544498487836959791636253209167350399025585785169021283231527357710484554980721525407657169290469326322822863184992213743178868498200222270801309797567400348596761477557415796634427690419403563011194249302152575062701292613967331058845014126474128577480085119949784227603045386781841262,
   0.1589688433939543476499564394650472016787801581951260957511749153247409785833850597426104767260064785656726957407308709294681940869471572774193889952003779483998952863244786932834096103688529075704047740756352615495602997460739650278393056497770505071451767267951634011784814089959663984428,
   0.1589688433939543476499564394650472016787801581951260957511749153247409785833850597426104767260064785656726957407308709294681940869471572774193889952003779483998952863244786932834096103688529075704047740756352615495602997460739650278393056497770505071451767267951634011784814089959663984428,
@@ -2456,8 +2371,7 @@ constexpr std::array<double, 19> weights {
   0.0448142267656996003328381574019942119517542274678576020858545267676429913842794576446690357102559934203280323775860360343000334458319796780552202725286599385464482175556425829180401153232218294624007148445216886976212985328934819110208162425464110028809041117163162427069065186589566497618,
   0.0194617882297264770363120414644384357529066090692866407926804724616014375681055482108520880452674917034745192947532937114169896428264362187916120668360924450291095851299100300403371064818583365857988451546956959577946464366542652257384919563191742022879389849394457667021090268241509572387,
   0.0194617882297264770363120414644384357529066090692866407926804724616014375681055482108520880452674917034745192947532937114169896428264362187916120668360924450291095851299100300403371064818583365857988451546956959577946464366542652257384919563191742022879389849394457667021090268241509572387};
-#elif LEGENDRE_GAUSS_N == 20
-constexpr std::array<double, 20> weights {
+constexpr std::array<double, 20> weights_20 {
   0.1527533871307258506980843319550975934919486451123785972747010498175974531627377815355724878365039059354400184281378782601150279679600783005530039321842277357554019203124915100518499038184507289979208511728338097884847930234840391745787787603960313774754576020521238652300682735542710944263,
   0.1527533871307258506980843319550975934919486451123785972747010498175974531627377815355724878365039059354400184281378782601150279679600783005530039321842277357554019203124915100518499038184507289979208511728338097884847930234840391745787787603960313774754576020521238652300682735542710944263,
   0.1491729864726037467878287370019694366926799040813683164962112178098444225955867806939613260352104810517091385456733800686575677792178649430941723424667532046356472774228709560694803833239714102500755019738911703717170310002053316744710774788331941474319396315320062727688974661711619397638,
@@ -2478,8 +2392,7 @@ constexpr std::array<double, 20> weights {
   0.0406014298003869413310399522749321098790906399899515368176068545618322967509873282955389206230443849761898257096750750226100388420589263242455270189562763042394217695623102760213193663915194028524305033283414664156073509698450908818586062170756508088247402639869134213644998336627334563899,
   0.017614007139152118311861962351852816362143105543336732524349326677348419259621847817403105542146097668703716227512570008208322919217356715608110009655621137928066105955538408464981760593482616529445662145250737154216181476956539350020274158495991703186071698688078395432051877120218676412,
   0.017614007139152118311861962351852816362143105543336732524349326677348419259621847817403105542146097668703716227512570008208322919217356715608110009655621137928066105955538408464981760593482616529445662145250737154216181476956539350020274158495991703186071698688078395432051877120218676412};
-#elif LEGENDRE_GAUSS_N == 21
-constexpr std::array<double, 21> weights {
+constexpr std::array<double, 21> weights_21 {
   0.1460811336496904271919851476833711882448095769419654441073225875154385927033996119297421911264662557212084193073183666407023291490701315394349933160814120091019135384560142780767922383392670660828128067346305807324319910469491126830892376430046688551997714362920589373449073057040164935385,
   0.1445244039899700590638271665537525436099499621970998347524729888860973093433918698652696658648520233050153807182751058340478607914609245155295922498562992808910783176715396139593722259868425469702253182886990329954188652290286970182071524397982404357217693477140670426040110571170384153735,
   0.1445244039899700590638271665537525436099499621970998347524729888860973093433918698652696658648520233050153807182751058340478607914609245155295922498562992808910783176715396139593722259868425469702253182886990329954188652290286970182071524397982404357217693477140670426040110571170384153735,
@@ -2501,8 +2414,7 @@ constexpr std::array<double, 21> weights {
   0.0369537897708524937999506682993296661889443081487298374271691818787857511575674084585234428769603298583529798398444489699045057647568225140933948134081451087223902427631700624411175063534535592342393984777089284336071796700434175156225807196391256954545850040503984567840458081566217952533,
   0.0160172282577743333242246168584710152658904221179024825481779101135587673613188623149067060951456754803600834495185032660756349493601107764372523080530746662957222301098339253312819296428454672989389933704031474029324391174520750132492689500208509817842805064822171006678776376184147041102,
   0.0160172282577743333242246168584710152658904221179024825481779101135587673613188623149067060951456754803600834495185032660756349493601107764372523080530746662957222301098339253312819296428454672989389933704031474029324391174520750132492689500208509817842805064822171006678776376184147041102};
-#elif LEGENDRE_GAUSS_N == 22
-constexpr std::array<double, 22> weights {
+constexpr std::array<double, 22> weights_22 {
   0.139251872855631993375410248341809957873920217457425858126197877073037712818768596298747496824058914113093167157962721105490063037735945705368013554774786449446301992859427256084690367597657268817092023841871315156005340599231398042635738899417087195975359991616234502233438058611331987745,
   0.139251872855631993375410248341809957873920217457425858126197877073037712818768596298747496824058914113093167157962721105490063037735945705368013554774786449446301992859427256084690367597657268817092023841871315156005340599231398042635738899417087195975359991616234502233438058611331987745,
   0.1365414983460151713525738312315173965863676529886861681094697349382075581645378333809906329322980338064166098619410384683080837352686179002153940492154657031000279046612887404941032702402863540489150533615329544848350259523513713718107237294224552847158550848712612535614861972824779777976,
@@ -2525,8 +2437,7 @@ constexpr std::array<double, 22> weights {
   0.0337749015848141547933022468659129013491693144744746604328831945599515117530614883989149488223271820394668642314209914197484933174725421873500935790418921972193376234783246855382688816781804190261643002466304858994685158135658866855354087005529714468844343938457001078010839443093190369368,
   0.0146279952982722006849910980471854451902119491243237309244975914201881065327481711422837741075183291745146645313623078477205144737567463695709303564356102011342773018068167026561369456028675505684034531150576801768514070973362409521530961694669031717636051398699267833817966933073957187542,
   0.0146279952982722006849910980471854451902119491243237309244975914201881065327481711422837741075183291745146645313623078477205144737567463695709303564356102011342773018068167026561369456028675505684034531150576801768514070973362409521530961694669031717636051398699267833817966933073957187542};
-#elif LEGENDRE_GAUSS_N == 23
-constexpr std::array<double, 23> weights {
+constexpr std::array<double, 23> weights_23 {
   0.1336545721861061753514571105458443385831528076368833174819359779914409808477228963591592070041770657260205575514973335616255714709828802742656649621614431236395579444474686400551369439625808317279421520974691891767430693132766928896317410571158028845306037337719405022210494063530132001372,
   0.1324620394046966173716424647033169258050356694742235243225122680384860058826794056735801177079407781158601039853288017359549544504047001640754418919869188082964921765010916486256230123511017510481207806942973304221070460743058914752549499390630704045790511113539726305631748190667260260389,
   0.1324620394046966173716424647033169258050356694742235243225122680384860058826794056735801177079407781158601039853288017359549544504047001640754418919869188082964921765010916486256230123511017510481207806942973304221070460743058914752549499390630704045790511113539726305631748190667260260389,
@@ -2550,8 +2461,7 @@ constexpr std::array<double, 23> weights {
   0.0309880058569794443106942196418845053837725289999280664348878065986177842628675920022497166599708966968626291921791497684070981953199775654051248414421907730305736748971104683094256127903293742829742435936067248779629027627709227731211868234500976143402273808846115120869044974015578997478,
   0.0134118594871417720813094934586150649766183341057372333923958821391608867360520598492990354585240646108689112727404454966057147664756976594529970634260506276899049348681928030346927787972868455103789165116839432854210682225141300634467223425543567869086594810794096566458542002488505907232,
   0.0134118594871417720813094934586150649766183341057372333923958821391608867360520598492990354585240646108689112727404454966057147664756976594529970634260506276899049348681928030346927787972868455103789165116839432854210682225141300634467223425543567869086594810794096566458542002488505907232};
-#elif LEGENDRE_GAUSS_N == 24
-constexpr std::array<double, 24> weights {
+constexpr std::array<double, 24> weights_24 {
   0.1279381953467521569740561652246953718517112395416678824212995763723475915405364024120919775667347423307078678605027534354336365506630173201256407760369958705384835762891562911475479559477218918074170718365754182501974550951925484331523758090745471505157505768499921691572488912345533434646,
   0.1279381953467521569740561652246953718517112395416678824212995763723475915405364024120919775667347423307078678605027534354336365506630173201256407760369958705384835762891562911475479559477218918074170718365754182501974550951925484331523758090745471505157505768499921691572488912345533434646,
   0.1258374563468282961213753825111836887264033255813454041780915168813938726666625968820381792564211407244125340112283619371640023694354842556219623307075721695505167028832011944572440814161265754364153991752782846305315778293182951298508346824950922490384565834525141570991957343073460241123,
@@ -2576,8 +2486,7 @@ constexpr std::array<double, 24> weights {
   0.0285313886289336631813078159518782864491977979319081166016648047576440056374291434256854254228098755422737224452711633426188506404779428430343631052424983978091405445557790206527391293478807818130301641760878492678184457761229065303399826533483010921962299302202888714000294545957159715602,
   0.0123412297999871995468056670700372915759100408913665168172873209410917255178811137917987186719204245118391668507179752021919736085531955203240536027970786521356478573832633493407323107496772162595516230980489700767963287958540270795597236457014112169997285946194632806836898378754527134097,
   0.0123412297999871995468056670700372915759100408913665168172873209410917255178811137917987186719204245118391668507179752021919736085531955203240536027970786521356478573832633493407323107496772162595516230980489700767963287958540270795597236457014112169997285946194632806836898378754527134097};
-#elif LEGENDRE_GAUSS_N == 25
-constexpr std::array<double, 25> weights {
+constexpr std::array<double, 25> weights_25 {
   0.1231760537267154512039028730790501424382336275181516653913521973169120079492614212846011251750495837731005458394599426103941266676578224607632368291279859827462166016027870986748142075559144945204714873730276047452864126791158001670846125582379239383834044010442203668469191328949369652465,
   0.1222424429903100416889595189458515058350592475630590409075800822320389672191801024303354089107890663711562015684530427678901911134701283448499508241468787857547117830628021267642296712562704558850590651201220454384784211691739810242594276037531960688066549757402659035930498275598325921439,
   0.1222424429903100416889595189458515058350592475630590409075800822320389672191801024303354089107890663711562015684530427678901911134701283448499508241468787857547117830628021267642296712562704558850590651201220454384784211691739810242594276037531960688066549757402659035930498275598325921439,
@@ -2603,8 +2512,7 @@ constexpr std::array<double, 25> weights {
   0.0263549866150321372619018152952991449359632817033224687553661657838709340088794993715298215281729288903503624646051039745439732965900776493480343700745542852132296428872440175257969606566544799360879857545008794273386894272541788825330738252051810057575947934059566744968403695361398514521,
   0.0113937985010262879479029641132347736033205262929096964489480611161898917297667433559236771129450335056884316180096637436022773929611922966477004202535787635169675980622028791259870979673123490283609299248488546479202148748404560356873018752159706618462279142059304383111363264922800226228,
   0.0113937985010262879479029641132347736033205262929096964489480611161898917297667433559236771129450335056884316180096637436022773929611922966477004202535787635169675980622028791259870979673123490283609299248488546479202148748404560356873018752159706618462279142059304383111363264922800226228};
-#elif LEGENDRE_GAUSS_N == 26
-constexpr std::array<double, 26> weights {
+constexpr std::array<double, 26> weights_26 {
   0.1183214152792622765163710857004686846498902708289053180943201993796206947495628682408562140672814183273234787825834197886357855451568519644439730889565575581950194738363915787996885243299886713072366592913757326080825201666139532888237316047456833266834800671302654927834441987700256624041,
   0.1183214152792622765163710857004686846498902708289053180943201993796206947495628682408562140672814183273234787825834197886357855451568519644439730889565575581950194738363915787996885243299886713072366592913757326080825201666139532888237316047456833266834800671302654927834441987700256624041,
   0.116660443485296582044662507540362213631964881221924216460162697211265665928319726512696339645002059417577132130491198043365979398112931053888563899466120738752206581979507044381283333958529627893164840198119157589733278651217928040168256042627115325735185815281630218550722407151981376664,
@@ -2631,8 +2539,7 @@ constexpr std::array<double, 26> weights {
   0.0244178510926319087896158275197884002404959261972703420520468950756917156988678896538281853633560265624400961257155257030129076271337043786757350847862624924014552536087369256260795633238900021627027055592823560557962774805006527779680074348299458662355943179946222257680639639644130566261,
   0.010551372617343007155651187685251977904345737179694614550055427636763222293509751344444703024130644662411193024636412174983816086271485784485522326809779318331906433654578237345120433132979174302994263871481757884062851232120570444540555609350901014521533412680183441207727520390447500238,
   0.010551372617343007155651187685251977904345737179694614550055427636763222293509751344444703024130644662411193024636412174983816086271485784485522326809779318331906433654578237345120433132979174302994263871481757884062851232120570444540555609350901014521533412680183441207727520390447500238};
-#elif LEGENDRE_GAUSS_N == 27
-constexpr std::array<double, 27> weights {
+constexpr std::array<double, 27> weights_27 {
   0.1142208673789569890450457369018352486807214433501653303217477165791941253411532521102748430978511915371961165808983829967440735628761152036707106947743738331089745167125981875228729825895722884716580596216277926033108572991526487146079534833591722665942131345759848669252638324238372956196,
   0.1134763461089651486203699480920992579205245188104720258964165495770223395939676265635919634979237774063328290351192489563917472496901331283039815027961701704889620166386504340105113346432455610709210941919139089781999968612101807706652419600557004546793725714523610058071513645706835635198,
   0.1134763461089651486203699480920992579205245188104720258964165495770223395939676265635919634979237774063328290351192489563917472496901331283039815027961701704889620166386504340105113346432455610709210941919139089781999968612101807706652419600557004546793725714523610058071513645706835635198,
@@ -2660,8 +2567,7 @@ constexpr std::array<double, 27> weights {
   0.0226862315961806231960342064467614888127677202881663556314421302390758300358100221545699223462632245950906801042915512215178230983425691509282120430602864921271713534358979689843073579087631569727310208190988260231706163728304052969051701383656383270073550822148794779706333863169649277125,
   0.0097989960512943602611500550912590980982258189350915921681404045658626304176681121554193822022149292857703256007037895639843115388157494161466184967592419685158039065521716125721547903667034270717148289900688153721732588995155663364930443519117898062879374639307491132683947680988167674767,
   0.0097989960512943602611500550912590980982258189350915921681404045658626304176681121554193822022149292857703256007037895639843115388157494161466184967592419685158039065521716125721547903667034270717148289900688153721732588995155663364930443519117898062879374639307491132683947680988167674767};
-#elif LEGENDRE_GAUSS_N == 28
-constexpr std::array<double, 28> weights {
+constexpr std::array<double, 28> weights_28 {
   0.1100470130164751962823762656018176139566255294912316332786681012296124101207071574068912667778348371808465639116876143097799221490136995721591772149339017163901457021174549909428311492378682472470508127064884681247201951042616508309392337140899075152445730963494024226401194931140942261464,
   0.1100470130164751962823762656018176139566255294912316332786681012296124101207071574068912667778348371808465639116876143097799221490136995721591772149339017163901457021174549909428311492378682472470508127064884681247201951042616508309392337140899075152445730963494024226401194931140942261464,
   0.108711192258294135253571519303673367875278454666043967657121170477313326383128788108242663150355703702326980895978636929100207225394016692379549311572112113816975929133758353524149574151167394223307448689718989290653409128009317870944794651253318656273924338884284339814428082880332328772,
@@ -2690,8 +2596,7 @@ constexpr std::array<double, 28> weights {
   0.0211321125927712597515003809932654344513693507232856377976684902510651557535770919641524533796102866875982355090530854590783965261502353092159603508052810740300484628254004527479714623312062408619424396240100985421872614971771213040371040833049054859978993205056711318833592093577797358387,
   0.009124282593094517738816153922951706240344491098290999416739691323899459865798129145091630865234989834113914351519333723264689555411773023921677795769166865124924070735055084695081417285192623761433213108747727148065359380741542252350005508063610915567192898268747101121764544257361500645,
   0.009124282593094517738816153922951706240344491098290999416739691323899459865798129145091630865234989834113914351519333723264689555411773023921677795769166865124924070735055084695081417285192623761433213108747727148065359380741542252350005508063610915567192898268747101121764544257361500645};
-#elif LEGENDRE_GAUSS_N == 29
-constexpr std::array<double, 29> weights {
+constexpr std::array<double, 29> weights_29 {
   0.1064793817183142442465111269096775683301850316129959797529729010678813249315863848447746456465105043580995902490182309981538093618250586440877968902533996256330987171256563365254844451251185186228060864962618185505299787426107926186119328548794186171342010671909300067412685429492133647631,
   0.1058761550973209414065913278521878930748313137422780398281553455250226381691394563839710191972884981221322416152718759548256980667391020600396231489770214567072610727249238651463107716158906291553393703363402862649591819133800233157421986997525981614408257553927842883031571368092447314087,
   0.1058761550973209414065913278521878930748313137422780398281553455250226381691394563839710191972884981221322416152718759548256980667391020600396231489770214567072610727249238651463107716158906291553393703363402862649591819133800233157421986997525981614408257553927842883031571368092447314087,
@@ -2721,8 +2626,7 @@ constexpr std::array<double, 29> weights {
   0.0197320850561227059838598016403956311496065681903615876560538446753443563388611129061643397077989716429755286691003093650540923235317075745229254844246629929000765815482436339194681377346290765724065679196202626057106707612680171759036808923291121450984888232462330393239730554721117504311,
   0.0085169038787464096542638133022498030023988897985184860524300945594652915878057648377018571014260680606593526340882441966834624695057106893606730956499264062489155671804533802747991401345292585793455325432442103738515766562968121890798239300042908821261694592897899496902383553608561079801,
   0.0085169038787464096542638133022498030023988897985184860524300945594652915878057648377018571014260680606593526340882441966834624695057106893606730956499264062489155671804533802747991401345292585793455325432442103738515766562968121890798239300042908821261694592897899496902383553608561079801};
-#elif LEGENDRE_GAUSS_N == 30
-constexpr std::array<double, 30> weights {
+constexpr std::array<double, 30> weights_30 {
   0.1028526528935588403412856367054150438683755570649282225863189866760162386566094293926288463218887091650381585270908625590053445978239177795052674324957515226663636160335575668878063493186261671686882624330929603473759846051176014653042963514948841143662284846586189686019067732898717610999,
   0.1028526528935588403412856367054150438683755570649282225863189866760162386566094293926288463218887091650381585270908625590053445978239177795052674324957515226663636160335575668878063493186261671686882624330929603473759846051176014653042963514948841143662284846586189686019067732898717610999,
   0.1017623897484055045964289521685540446327062894871268408642609454196425136053176749454759978197839119888169338588769649886018819457568530510708281309698946557409161878458726265960868539155064191296592463121210969643911447519855356836414089532555801463383240633692238060254720273710309278594,
@@ -2753,8 +2657,7 @@ constexpr std::array<double, 30> weights {
   0.0184664683110909591423021319120472690962065339681814033712983655145855995213079736540805190296754179556380958320461635999372661279183091178697974341059394966404363209112875218225559374625772771412570364902798372901542832626799720933912035579156051240269314197714911156876559705067118501012,
   0.0079681924961666056154658834746736224504806965871517212294851633569200384329013332941536616922861735209846506562158816909503692653793774223661109542198348044851955603309467397707138540407696809336917394179025875658501026293415549754075585346733118577944700418384800474712363695707696266864,
   0.0079681924961666056154658834746736224504806965871517212294851633569200384329013332941536616922861735209846506562158816909503692653793774223661109542198348044851955603309467397707138540407696809336917394179025875658501026293415549754075585346733118577944700418384800474712363695707696266864};
-#elif LEGENDRE_GAUSS_N == 31
-constexpr std::array<double, 31> weights {
+constexpr std::array<double, 31> weights_31 {
   0.099720544793426451427533833734349439643253411500204351485614579564092812110746874464409137442101408868147379005324045679852683065184758355545283247896003811727147601886670866673190427276385709428226303690567780120163351579968484242196399135683118371925890697681412077072988229609044774492,
   0.0992250112266723078748755144286150140175432199555630697812031425154690744703577043343077241074151664245493571240657787424095339900536681131181394325783274104055936643281595864779660621892561493716322578173336536101981951493491739733508806219067194678295014488321720018780823011384395019756,
   0.0992250112266723078748755144286150140175432199555630697812031425154690744703577043343077241074151664245493571240657787424095339900536681131181394325783274104055936643281595864779660621892561493716322578173336536101981951493491739733508806219067194678295014488321720018780823011384395019756,
@@ -2786,8 +2689,7 @@ constexpr std::array<double, 31> weights {
   0.0173186207903105824631579960868211413662728627679957766327551837888101544151458423020451097534446593521111870107363936814185527243777079750584651460422080038422472864908717819254502526484071448743723776571220329324331646443516243941010597712244618190381434448742900317473765902792360816522,
   0.007470831579248775858696875032212407022150852484048039699270970328678273100174321681955848402294104230725889217530374743663321465418972576742801761744005056834728399646263099638779129762297531471686346638608162874135480234179814430318198784703205596342071023449012906101195093217830616196,
   0.007470831579248775858696875032212407022150852484048039699270970328678273100174321681955848402294104230725889217530374743663321465418972576742801761744005056834728399646263099638779129762297531471686346638608162874135480234179814430318198784703205596342071023449012906101195093217830616196};
-#elif LEGENDRE_GAUSS_N == 32
-constexpr std::array<double, 32> weights {
+constexpr std::array<double, 32> weights_32 {
   0.0965400885147278005667648300635757947368606312355700687323182099577497758679466512968173871061464644599963197828969869820251559172455698832434930732077927850876632725829187045819145660710266452161095406358159608874152584850413283587913891015545638518881205600825069096855488296437485836866,
   0.0965400885147278005667648300635757947368606312355700687323182099577497758679466512968173871061464644599963197828969869820251559172455698832434930732077927850876632725829187045819145660710266452161095406358159608874152584850413283587913891015545638518881205600825069096855488296437485836866,
   0.0956387200792748594190820022041311005948905081620055509529898509437067444366006256133614167190847508238474888230077112990752876436158047205555474265705582078453283640212465537132165041268773645168746774530146140911679782502276289938840330631903789120176765314495900053061764438990021439069,
@@ -2820,8 +2722,7 @@ constexpr std::array<double, 32> weights {
   0.0162743947309056706051705622063866181795429637952095664295931749613369651752917857651844425586692833071042366002861684552859449530958901379260437604156888337987656773068694383447504913457771896770689760342192010638946676879735404121702279005140285599424477022083127753774756520463311689155,
   0.0070186100094700966004070637388531825133772207289396032320082356192151241454178686953297376907573215077936155545790593837513204206518026084505878987243348925784479817181234617862457418214505322067610482902501455504204433524520665822704844582452877416001060465891907497519632353148380799619,
   0.0070186100094700966004070637388531825133772207289396032320082356192151241454178686953297376907573215077936155545790593837513204206518026084505878987243348925784479817181234617862457418214505322067610482902501455504204433524520665822704844582452877416001060465891907497519632353148380799619};
-#elif LEGENDRE_GAUSS_N == 33
-constexpr std::array<double, 33> weights {
+constexpr std::array<double, 33> weights_33 {
   0.0937684461602099965673045415463487843844733639818266812867486955680725799829245174027134588987252917180743031234635654510276836168495799413024518327323304896314041729402671877624857644912938167626296923591748455859019945067839557979881659457663114902223251372137428530052708421668152884111,
   0.093356426065596116160999126274275464952003986088630804966219247739008459630832898842831723220408308492778153935559392619964080349982292203338766927835485425494047234165286366261283034880201806260786267632822163196571680292638653157809546765609324797855645189962368010944486683142410775604,
   0.093356426065596116160999126274275464952003986088630804966219247739008459630832898842831723220408308492778153935559392619964080349982292203338766927835485425494047234165286366261283034880201806260786267632822163196571680292638653157809546765609324797855645189962368010944486683142410775604,
@@ -2855,8 +2756,7 @@ constexpr std::array<double, 33> weights {
   0.0153217015129346761279457685336618667575353547807562367815100107172254859382741670445544700043527096827725592365176072989523361937306810142212884259854088100262916702167950321596501554849706120441794193685700840161227543801298709774791746544007719554633122056342446176723512564182625113168,
   0.0066062278475873780586492352084738550310591625032110713495328760472500755998864944280869720409950990306962081437894201401257169101045822443444991421203760524564859739242165690662876497294024902779355785518931550709006431870350273133532654395632930057080544640011450705469709901395879106314,
   0.0066062278475873780586492352084738550310591625032110713495328760472500755998864944280869720409950990306962081437894201401257169101045822443444991421203760524564859739242165690662876497294024902779355785518931550709006431870350273133532654395632930057080544640011450705469709901395879106314};
-#elif LEGENDRE_GAUSS_N == 34
-constexpr std::array<double, 34> weights {
+constexpr std::array<double, 34> weights_34 {
   0.0909567403302598736153376039485779599246056162602594401156125680698440288103832353984335132222316706821145615188195923116087754441876419105563104456332105550158863012853400904911424307590348013163611181929746905410226241439774532650104103470780556607518986255945545072642322517224586336727,
   0.0909567403302598736153376039485779599246056162602594401156125680698440288103832353984335132222316706821145615188195923116087754441876419105563104456332105550158863012853400904911424307590348013163611181929746905410226241439774532650104103470780556607518986255945545072642322517224586336727,
   0.0902030443706407295739422420174939288410295000506306356949861227618211051224911655789111917589310374868581472334155938708372688352656715400715971190668833470617070771508272396226092309758563091715169359212459223484807407425772119604018578974062720565530423997544841513823466424674007667733,
@@ -2891,8 +2791,7 @@ constexpr std::array<double, 34> weights {
   0.014450162748595035415202210328746990687540433584656060141734033887568915871889084946241555914043602739923176811717063968575802759513353566393611327882986683843092699708370520654463160606685881854262172605840260461382506415545726006107036225064699981593582010571968667914561292724476765403,
   0.0062291405559086847186064610714377861245273284298048459413498383766285440867939995875614537826999227402764393410433091165551392587866509368139286959877996451003520117996847650274381131001264048936968800841034394024893913832298059154406321866154360756368352692017290255789475172753727218118,
   0.0062291405559086847186064610714377861245273284298048459413498383766285440867939995875614537826999227402764393410433091165551392587866509368139286959877996451003520117996847650274381131001264048936968800841034394024893913832298059154406321866154360756368352692017290255789475172753727218118};
-#elif LEGENDRE_GAUSS_N == 35
-constexpr std::array<double, 35> weights {
+constexpr std::array<double, 35> weights_35 {
   0.0884867949071042906382073877776156691824091500106054233203930547564831856818455037694177620301440303886480770699786789072555120498596852344045994437865910579705332440154684645334151377566821650429387137691478542835124127753814309407953631292292702715893941703012952963870147702406844680843,
   0.0881405304302754629707388075930966414254543172744908371705717846022291674574661997559966193028505447037238747147414162866253701056371609696816449688811605670137066381598880078408393786511036118542923172354133057855589462238197132949173859174281740200219704353681146949100832444818916186058,
   0.0881405304302754629707388075930966414254543172744908371705717846022291674574661997559966193028505447037238747147414162866253701056371609696816449688811605670137066381598880078408393786511036118542923172354133057855589462238197132949173859174281740200219704353681146949100832444818916186058,
@@ -2928,8 +2827,7 @@ constexpr std::array<double, 35> weights {
   0.0136508283483614922664040029205163839739940378414249209971900998825644897453312048959913666263827915062302750503113695050715261718993609083181273617156847041333238175043551021796813573967127638784726095457066616992282166165624708392298265492134768359888028007690170668694102585428929327572,
   0.0058834334204430849757538962401126240307543177982329737116842045198831895048122386649141545472257947701122373467092671865230057274106977524783672989448275521632482429957066490278062266912305090329572584578363454778528888312161805226495706304928570277941362989371159823497940141887892711196,
   0.0058834334204430849757538962401126240307543177982329737116842045198831895048122386649141545472257947701122373467092671865230057274106977524783672989448275521632482429957066490278062266912305090329572584578363454778528888312161805226495706304928570277941362989371159823497940141887892711196};
-#elif LEGENDRE_GAUSS_N == 36
-constexpr std::array<double, 36> weights {
+constexpr std::array<double, 36> weights_36 {
   0.0859832756703947474900851747905265541600549156034958522907520701334269219259454985740935601391647868886347499176352850183377229381328679235373397113377036108801987509830239464462679016813895095209927382094635748034851253597965507734471845234745618556480733569914364445104148396408290357606,
   0.0859832756703947474900851747905265541600549156034958522907520701334269219259454985740935601391647868886347499176352850183377229381328679235373397113377036108801987509830239464462679016813895095209927382094635748034851253597965507734471845234745618556480733569914364445104148396408290357606,
   0.0853466857393386274918505430764897709987865854972912941284849709033699606923643584495079422491248784638788708201422634846432027980201526776635248801278203163605081248788080857614381653770809673649995313752445532543951348285696058006612686268589027263660939033656157260805672413441619459714,
@@ -2966,8 +2864,7 @@ constexpr std::array<double, 36> weights {
   0.0129159472840655744045034114977916491919612128514796718500303920436209214297608153678848815892022869866990853985347380194938892221718134354279766454316006462476872423163543325820281344574022971170053578980846593713706038861508690729641627862234478690767089143111746152813951832626369710081,
   0.0055657196642450453612559843905478374172245918941785101760579133845148979874965027963746750171292260392955534081460616074171279791543503755081140001156132948835037018061510575750709104360185993725124919550989803156506065336232873490929203051294587538637390541937489122683507770673132663416,
   0.0055657196642450453612559843905478374172245918941785101760579133845148979874965027963746750171292260392955534081460616074171279791543503755081140001156132948835037018061510575750709104360185993725124919550989803156506065336232873490929203051294587538637390541937489122683507770673132663416};
-#elif LEGENDRE_GAUSS_N == 37
-constexpr std::array<double, 37> weights {
+constexpr std::array<double, 37> weights_37 {
   0.0837683609931389047970173663694593917168752800684767192280711460660352144950122519248834328641830996228545711341799619165837425979679708281872614164699941644483645611716925712456581581684880101502180957230209051507904214440426110294162093611987832519940502883202912374854427627698517681791,
   0.083474573625862787252253009484518699020435310203026050059846109756991985079347159060791009772803248334388301033680897158446780513839742151993742973825595394018277263245593368537893791639053138935777611989172876136354422611308025116760441662280855673624190690670421357800500457543749683621,
   0.083474573625862787252253009484518699020435310203026050059846109756991985079347159060791009772803248334388301033680897158446780513839742151993742973825595394018277263245593368537893791639053138935777611989172876136354422611308025116760441662280855673624190690670421357800500457543749683621,
@@ -3005,8 +2902,7 @@ constexpr std::array<double, 37> weights {
   0.0122387801003075565263048524363465759422909531112660823040416890298892819780882215962874221663011459316727690669058864281381872631802260682118589581438043035577153333732574747585022449042386700140804915585056020840484563942748405852029996118528161888764457928569240935599414063725086345128,
   0.0052730572794979393517220542335303891830883059065272654337634972771556321427294743726164543859933838325996484245470104780441969300659719347443648047707148794202589824141538687279781589593290334907927879418573338021787355953111778672882313334803174138192281322527193367034341769603704166608,
   0.0052730572794979393517220542335303891830883059065272654337634972771556321427294743726164543859933838325996484245470104780441969300659719347443648047707148794202589824141538687279781589593290334907927879418573338021787355953111778672882313334803174138192281322527193367034341769603704166608};
-#elif LEGENDRE_GAUSS_N == 38
-constexpr std::array<double, 38> weights {
+constexpr std::array<double, 38> weights_38 {
   0.0815250292803857866992187698858300556016426514704967984381025969810613740455260134645356096536517518325244361399729923311904673697738497632791280686590776524802100556645013968622133901828861830588920043407937193348376699381459622360465391802375859166845903438152394943202482472881261699113,
   0.0815250292803857866992187698858300556016426514704967984381025969810613740455260134645356096536517518325244361399729923311904673697738497632791280686590776524802100556645013968622133901828861830588920043407937193348376699381459622360465391802375859166845903438152394943202482472881261699113,
   0.0809824937705971006232694699490581419365151697840887541415660285674956476215695785864793808704972846251788446435353953176505178426035265559751550846421476416169233449477753175084271510914344979033709739945310763790096212992182208403080387805470945324269604464850156957757495756055449144869,
@@ -3045,8 +2941,7 @@ constexpr std::array<double, 38> weights {
   0.0116134447164686741776683012004374273572367478601123296850107011099528374550670585784366381102359245004577044709616421728412808931702179272952910329600397172805136223339271978309539671806625614525221870194082510266081814959627855375406675177560920721008094852448488540407921315418297500643,
   0.0050028807496393456758995420918993704638392718626217059140341376536029812792271634022832313624767863160394010465356734678215868527450490515547453501246953026748161876142557276297899208644197360968138749364594122151354780554421711532863861620978048529403252697746944301330362380158277935132,
   0.0050028807496393456758995420918993704638392718626217059140341376536029812792271634022832313624767863160394010465356734678215868527450490515547453501246953026748161876142557276297899208644197360968138749364594122151354780554421711532863861620978048529403252697746944301330362380158277935132};
-#elif LEGENDRE_GAUSS_N == 39
-constexpr std::array<double, 39> weights {
+constexpr std::array<double, 39> weights_39 {
   0.0795276221394428524174181966058509938456067747658648143098847698352102891063758657327624438237214962888902042851780835026606997445534187218293264203699352882731350600472873588946287839548301687422188890361881571582783488265598489983412270332485489913737071770772521676061665676789388252799,
   0.0792762225683684710101557717545079305238041486782664247002041873408340880524158407734728641229198744528071709991790856347961739801064046084930218574184126233290531785846036343920282932249007774688941160940351435865738548566274824270460412350541913130327376449165453775007246803700651204236,
   0.0792762225683684710101557717545079305238041486782664247002041873408340880524158407734728641229198744528071709991790856347961739801064046084930218574184126233290531785846036343920282932249007774688941160940351435865738548566274824270460412350541913130327376449165453775007246803700651204236,
@@ -3086,8 +2981,7 @@ constexpr std::array<double, 39> weights {
   0.0110347889391645942426768054521772894535071393731181559393679976496065611110827562649568172600466056772028502969641319277480714507111171051434914481854959295933475831520646060184593357634840834458629259284799798095381910014208743926617498886088134323701182476436647215548675773077398375032,
   0.0047529446916351013707762131549069419856950845418370614396590288129611952090723538169580668642151435420781367221233036111336394650422356240674974975549489209075584111237353930656761558899802846983282409260556417050432904952397256748268400832235725556863270838668865501535212314824620035151,
   0.0047529446916351013707762131549069419856950845418370614396590288129611952090723538169580668642151435420781367221233036111336394650422356240674974975549489209075584111237353930656761558899802846983282409260556417050432904952397256748268400832235725556863270838668865501535212314824620035151};
-#elif LEGENDRE_GAUSS_N == 40
-constexpr std::array<double, 40> weights {
+constexpr std::array<double, 40> weights_40 {
   0.0775059479784248112637239629583263269636686527881064357329542738540721327490710463728207484145373962887436020545761738921291514892183177650943670333701710492145517561609565879019048590777336262752626659343741118947295588687483940522813185199346231557824654943279937427947959503155501733276,
   0.0775059479784248112637239629583263269636686527881064357329542738540721327490710463728207484145373962887436020545761738921291514892183177650943670333701710492145517561609565879019048590777336262752626659343741118947295588687483940522813185199346231557824654943279937427947959503155501733276,
   0.0770398181642479655883075342838102485244397541639404154891808924325416430904644372005083887322608362903719810482581464584425749029421246936054323976708766641864462820632748839023735155531955594595624264541202634262497035522823610686860379008884163905995163674516796003369858129155848786735,
@@ -3128,8 +3022,7 @@ constexpr std::array<double, 40> weights {
   0.0104982845311528136147421710672796523767926213157967797156751236116252988969108307005368304740322441458709767603875595729724617702108542404006228599466228502384496773562149845593713443184160690657547364709584409390648455906754309423791758497005415246367622050095385595086131913536958600647,
   0.004521277098533191258471732878185332727831110199705990700341942342663947001948225131287635827890030939506746956476209979989035875404887600511081280420539663019714823882850996547580441433943953790566043840225961131927694334598813535774631564896828221623886602157241389785685501525778663856,
   0.004521277098533191258471732878185332727831110199705990700341942342663947001948225131287635827890030939506746956476209979989035875404887600511081280420539663019714823882850996547580441433943953790566043840225961131927694334598813535774631564896828221623886602157241389785685501525778663856};
-#elif LEGENDRE_GAUSS_N == 41
-constexpr std::array<double, 41> weights {
+constexpr std::array<double, 41> weights_41 {
   0.0756955356472983723187799610763602558911188813952312331325494537396409652410478198527185663997349161583725918240838391458995357473441225192902571520475291262564045782722544760448578550432648839902142905757888467895570244631146688859880804599629258692432667955524113433491174945189185725448,
   0.0754787470927158240272470626746167490736063609030627762297347379879422381170674875443067346474261201461784898759053498150558324389520704581490422964233872643292566122266760477562234853486567366901923815006923486021424403096923517558158981705718086057137908473920516574173783573195086705648,
   0.0754787470927158240272470626746167490736063609030627762297347379879422381170674875443067346474261201461784898759053498150558324389520704581490422964233872643292566122266760477562234853486567366901923815006923486021424403096923517558158981705718086057137908473920516574173783573195086705648,
@@ -3171,8 +3064,7 @@ constexpr std::array<double, 41> weights {
   0.009999938773905945338496296629698839550224935771150205951661212191055021944662486990875781317038927810957484791607749785179972059594188416231245703546402585630864829075130500303772345374474031780156804336222217396766788491118255673466604233904137269600025094279109748181130924861682042181,
   0.0043061403581648876840044779046544861863622039953017048216709247138802133615584036977413621809593953025252946739678214322998183926312803381449163018314068789199240534709693563825259417427806459429596328436188700240855475269518265336099896679682579774596745658521044817340085203149363425241,
   0.0043061403581648876840044779046544861863622039953017048216709247138802133615584036977413621809593953025252946739678214322998183926312803381449163018314068789199240534709693563825259417427806459429596328436188700240855475269518265336099896679682579774596745658521044817340085203149363425241};
-#elif LEGENDRE_GAUSS_N == 42
-constexpr std::array<double, 42> weights {
+constexpr std::array<double, 42> weights_42 {
   0.0738642342321728799963855611497914131284705205020709080739717027887304904536477047533554069576581154669590360355631466883265917666302261897290225831595501844628719066170739042556352374332559716234641506978813807557493306222376081116854140007126732493904923865960372768318989333785241242445,
   0.0738642342321728799963855611497914131284705205020709080739717027887304904536477047533554069576581154669590360355631466883265917666302261897290225831595501844628719066170739042556352374332559716234641506978813807557493306222376081116854140007126732493904923865960372768318989333785241242445,
   0.073460813453467528264028257054303938733655783450405239362752101300684363045281734613103388893146908122069883495241856323835372278005393488243952190153845532845210884973796004339205000983059846471285864932978510531851558028628641106063797248395854378638615089860929363962207611685712046074,
@@ -3215,8 +3107,7 @@ constexpr std::array<double, 42> weights {
   0.0095362203017485024118201002926979981886847987350125725118652036428031899307189703049478568696213371479460309794247391741890456248081871185293351141180110545720465539120524377954211319291357593121460980410191222528150561901341246891300769632726477430989242072265593764553998406688487975566,
   0.0041059986046490846106027794968359626570167733748022903578521270428391487776731442043396282630437397019805843273160208463132051353609107864270649020099228289995442447748346122569310245013763451523580600000992678031842902944098700202045987418191232375295633413587192433789969495103265748308,
   0.0041059986046490846106027794968359626570167733748022903578521270428391487776731442043396282630437397019805843273160208463132051353609107864270649020099228289995442447748346122569310245013763451523580600000992678031842902944098700202045987418191232375295633413587192433789969495103265748308};
-#elif LEGENDRE_GAUSS_N == 43
-constexpr std::array<double, 43> weights {
+constexpr std::array<double, 43> weights_43 {
   0.0722157516937989879774623317137368801470706905252503489701553468884405963684198778908575181877406122787286381707322294501713256129340357620486823235326346017935628318400524044040720693868681748830384037726833562665108659561569907598069085621279617270660479325875898375704939212176162044181,
   0.0720275019714219743453075516708570877535042459474147016448449738725959872303670597353621504816762120184349025299321888367527956983036774650680940572838069244353662925140431174691528382776697288850822209270561026073373233600931850901670012474336194012325248835851656854505781278598534127616,
   0.0720275019714219743453075516708570877535042459474147016448449738725959872303670597353621504816762120184349025299321888367527956983036774650680940572838069244353662925140431174691528382776697288850822209270561026073373233600931850901670012474336194012325248835851656854505781278598534127616,
@@ -3260,8 +3151,7 @@ constexpr std::array<double, 43> weights {
   0.0091039966374014033188686082958967238130179755598267040770628336822496596787276352582645637760423918090281360435519119047840195361820296357637529010848180150891441690978239565176140774886456322475316510324838415268419461279155471299211569804646897647030111235879018429932474225784192957528,
   0.0039194902538441272829671651925764354336603645726908723443427432132992435327623637264897973120955700517168425828986387742498292005467551908796117968159527570107655538042286768526903218037897308589793240752430907362487933440374146642362505685131519971600824592728482597460105946598897903929,
   0.0039194902538441272829671651925764354336603645726908723443427432132992435327623637264897973120955700517168425828986387742498292005467551908796117968159527570107655538042286768526903218037897308589793240752430907362487933440374146642362505685131519971600824592728482597460105946598897903929};
-#elif LEGENDRE_GAUSS_N == 44
-constexpr std::array<double, 44> weights {
+constexpr std::array<double, 44> weights_44 {
   0.0705491577893540688113382874802998849910634255089236447907414326260208751999569079495016727567606920269128095682406802714103149431654106915194181052750815434519232539128527064721494678952091093759983483775238425641871151214885475111023776013321110503572906723961233022373951090503872523434,
   0.0705491577893540688113382874802998849910634255089236447907414326260208751999569079495016727567606920269128095682406802714103149431654106915194181052750815434519232539128527064721494678952091093759983483775238425641871151214885475111023776013321110503572906723961233022373951090503872523434,
   0.0701976854735582125871420419443993876688266862156284579333328387082539035726253988615994022381085954045429976935308906446766529728359407675287202918515574237278773443609137569434575348666108442236442355249114807857801224207917495989427625257777172281966900820280153758361894881888446223219,
@@ -3306,8 +3196,7 @@ constexpr std::array<double, 44> weights {
   0.008700481367524844122565623424313140208468421158361896093374448982742925916789764877056550502231350368724113975650323487367358419428814204082484999760372994472551988317836378198961457508926114641451788789409841814354310434490105417266944471635976336030509380605687911242458133624641993464,
   0.0037454048031127775151737788317615384776979163432821731665936393976361923828788698700858334414825951421743541696629227456919667130908567503197294376766504845862353441291078993449098424655787524409261811103029599961620404427138783428505256291127020922823873017301745057662098067031405532483,
   0.0037454048031127775151737788317615384776979163432821731665936393976361923828788698700858334414825951421743541696629227456919667130908567503197294376766504845862353441291078993449098424655787524409261811103029599961620404427138783428505256291127020922823873017301745057662098067031405532483};
-#elif LEGENDRE_GAUSS_N == 45
-constexpr std::array<double, 45> weights {
+constexpr std::array<double, 45> weights_45 {
   0.0690418248292320201107985551594047407233228922750047780771460501609980220095115474551605704747979384551203177770556030693983636477236015976919748041279904143567099468851068913216214944854206353449690615821802359170197711067258933881413209759406093351110463197479377410056672748036073934585,
   0.0688773169776613228820028482980557888845241301106485451587410683850830032414498831551504284171398593987429110979060946904076110644667539683665370685707326792485773846753064059401870208339758050761944697716043025505552716005717338577971624131214545221921081321130874154218253674834064118515,
   0.0688773169776613228820028482980557888845241301106485451587410683850830032414498831551504284171398593987429110979060946904076110644667539683665370685707326792485773846753064059401870208339758050761944697716043025505552716005717338577971624131214545221921081321130874154218253674834064118515,
@@ -3353,8 +3242,7 @@ constexpr std::array<double, 45> weights {
   0.0083231892962182416457358531222338537561579312929482218949564792158557444073242835173302795787792589218850608876106544606832348636759104316677981622774691600808794739608121440289646472575223140871049805920876493186100404781886331612953622906241329781103563269616770850369969441870463300802,
   0.003582663155283558931143028659351392570585636358183944614043812970337282458387026250335092559376358788294661684969493696951938759422853942353427894098380593037638343139717526519956842932428922815145354833707165261186466081013564730510541491489176963896154025735626401771723982276032915836,
   0.003582663155283558931143028659351392570585636358183944614043812970337282458387026250335092559376358788294661684969493696951938759422853942353427894098380593037638343139717526519956842932428922815145354833707165261186466081013564730510541491489176963896154025735626401771723982276032915836};
-#elif LEGENDRE_GAUSS_N == 46
-constexpr std::array<double, 46> weights {
+constexpr std::array<double, 46> weights_46 {
   0.0675186858490364588202141891643010802121482695398182551451699354871041635199993775723880329698085717670869626199795530003891345240444199590827048410198577870521901172677690017568712439750628635280299975374634080832643517106902506165020695253322804548295133084068903465516602268733612328821,
   0.0675186858490364588202141891643010802121482695398182551451699354871041635199993775723880329698085717670869626199795530003891345240444199590827048410198577870521901172677690017568712439750628635280299975374634080832643517106902506165020695253322804548295133084068903465516602268733612328821,
   0.0672106136006781758623741548270975961765396811656452021597761229459225252451843015633766286231392874012025404027230520662760071316164488888348329069618055990894756684741246280528859457291566051062778742362049938829178485584594973116703462667970199094383491878003747881603937324018492884703,
@@ -3401,8 +3289,7 @@ constexpr std::array<double, 46> weights {
   0.0079698982297246224516130389263249654262887709925965393803974999979756281243706337056814973872702014226274826016188869062378360898018792682378282301421451658403523453469933351173657207264839439782989724115950811361583343336938107496832527663477395413297008860027674333493011158245361174164,
   0.0034303008681070482860187831480434044411729458052113312443288164348759498925512381825033889217970518701696628657488319845910116951026737379988592846933232414208984123245692408478035306849070658308357728573451775161500478630705114668337533514140229369873861457522338543528133412265939673044,
   0.0034303008681070482860187831480434044411729458052113312443288164348759498925512381825033889217970518701696628657488319845910116951026737379988592846933232414208984123245692408478035306849070658308357728573451775161500478630705114668337533514140229369873861457522338543528133412265939673044};
-#elif LEGENDRE_GAUSS_N == 47
-constexpr std::array<double, 47> weights {
+constexpr std::array<double, 47> weights_47 {
   0.0661351296236554796534403543310549711953604527179312405664287198463883271037240536057581562357050419968468050775236107265038195919344232597176182370008273955540055444132576650233368412544816950610930440506534084202869333009651382568162223563106968551810656462592287279167007485216990695147,
   0.0659905335888104745335706553304982595773582776265029978891534402810236755283439150430991292270852022317847028357837716180507628787981899653738695993421881544596203794714644342980414451367732151760579149452686801899629335392437217558135641716656822023280002766318001379564723335820295455415,
   0.0659905335888104745335706553304982595773582776265029978891534402810236755283439150430991292270852022317847028357837716180507628787981899653738695993421881544596203794714644342980414451367732151760579149452686801899629335392437217558135641716656822023280002766318001379564723335820295455415,
@@ -3450,8 +3337,7 @@ constexpr std::array<double, 47> weights {
   0.0076386162958488336141043567711316555044205898225651053580431706461783653259017084664637282233458328856530445047483424422230452097261538438998997145011063630118301213980209618624636905846010953967875720249943451452440867575159427180667313347378089748333339497750187328188371009578255669029,
   0.0032874538425280148832499642083361798513606224070709461606918944907631715693237104061019864486436395158547061107128844724888630781971722366894477480958977042251186145189929826020363710118991939285154727126743754604800520771915970534867646751487263251752771881894131224916107334399177850919,
   0.0032874538425280148832499642083361798513606224070709461606918944907631715693237104061019864486436395158547061107128844724888630781971722366894477480958977042251186145189929826020363710118991939285154727126743754604800520771915970534867646751487263251752771881894131224916107334399177850919};
-#elif LEGENDRE_GAUSS_N == 48
-constexpr std::array<double, 48> weights {
+constexpr std::array<double, 48> weights_48 {
   0.0647376968126839225030249387365915535520819189466365100145630955230830789112652102024388586148790257788504178817149406047213653777355165787109361497393610668464404058173590514459457218162820036853260853476893083916876577017950192396753949750327804531473587112366883193491439113058399613456,
   0.0647376968126839225030249387365915535520819189466365100145630955230830789112652102024388586148790257788504178817149406047213653777355165787109361497393610668464404058173590514459457218162820036853260853476893083916876577017950192396753949750327804531473587112366883193491439113058399613456,
   0.0644661644359500822065041936577050657256919244555303087605584565373923533729548831698602843931871385340030175202203667683923636126306800176183882596684399495491942372660596596356926236523817913678955210087298528334383346959188152334943162945018899436306253539186876929627564832875066671546,
@@ -3500,8 +3386,7 @@ constexpr std::array<double, 48> weights {
   0.0073275539012762621023839796217865500587079025592013532748818295488069800725028316706480375165203492985348352058130145019210595229781155983356959210927756601384839999895988071487053794233206191516948990247724302244333532639963678373653429402048630396323584935042879329231777271594470137779,
   0.0031533460523058386326773115438914875782839388316936222952094932503195864383168624422174587740479242783786832411810766857395666084711474099319465151509325584851182123492882592877145774634208031405492080241435958192743600081224060525654433479828742651348932788741657302081374766455222910404,
   0.0031533460523058386326773115438914875782839388316936222952094932503195864383168624422174587740479242783786832411810766857395666084711474099319465151509325584851182123492882592877145774634208031405492080241435958192743600081224060525654433479828742651348932788741657302081374766455222910404};
-#elif LEGENDRE_GAUSS_N == 49
-constexpr std::array<double, 49> weights {
+constexpr std::array<double, 49> weights_49 {
   0.0634632814047905977182534678795296349996295223082522191857774970954097066418076715983618458838252464642794830898019154993189505788491924991209464465014187086032606307072659975900741700334551542777002805050834872971016636090894121381526765135109727423311850266477563469887873905014555002757,
   0.0633355092964917485908369274000905201479714165648258204473111760757484435249037123279548160186424163199961837393956283042791094253484395120741834289362558939566562058620324806260129244414431898561728073439897739290727487611276200782733727346138781352065707089134162100561372083251063303787,
   0.0633355092964917485908369274000905201479714165648258204473111760757484435249037123279548160186424163199961837393956283042791094253484395120741834289362558939566562058620324806260129244414431898561728073439897739290727487611276200782733727346138781352065707089134162100561372083251063303787,
@@ -3551,8 +3436,7 @@ constexpr std::array<double, 49> weights {
   0.0070350995900864514734506783113484108628638570390273368512183971194731468994596016732634679637358014143729336550893095487306380802966459800508389662811297394086939472316319767468262053280633494352358345232720341699813515942674269825775012994992225157490630461832673846962892095448216016205,
   0.0030272789889229050774806981758271409728300420038317733852349850511774944135506758868197701260589851248700325231869955440479592073488712071300216943920329006221646236526447041755213219378999077532861051739710398180037077104849040354531696192303071705804494274957360382976466337479506279005,
   0.0030272789889229050774806981758271409728300420038317733852349850511774944135506758868197701260589851248700325231869955440479592073488712071300216943920329006221646236526447041755213219378999077532861051739710398180037077104849040354531696192303071705804494274957360382976466337479506279005};
-#elif LEGENDRE_GAUSS_N == 50
-constexpr std::array<double, 50> weights {
+constexpr std::array<double, 50> weights_50 {
   0.0621766166553472623210331073606134308676824692010266331011656376197576116005161496153965234256251945035190878538514646027013624173900556610838761659666942055109367824940206833480509708770585965856278059828616376291100636294863879189012831678201204004108488665741182142651742559639551734037,
   0.0621766166553472623210331073606134308676824692010266331011656376197576116005161496153965234256251945035190878538514646027013624173900556610838761659666942055109367824940206833480509708770585965856278059828616376291100636294863879189012831678201204004108488665741182142651742559639551734037,
   0.0619360674206832433840875097808306885728770566912449049427597061169548212868868663541874012601839334985088784270698064309969541498088869067871658103239608498898570222942039787789491100273928863404949851014677414818424352394725004762435803560633359022843198264104954032099529619257259491801,
@@ -3603,8 +3487,7 @@ constexpr std::array<double, 50> weights {
   0.0067597991957454015027788781779850318018738324064668105528787058554029967944856787527566093874153215001888105419718171291279415096115053570914447616194407900935890266684583680811662741768053259969244873142935863704016269005056434462624167822195711509108470288942381864465704162582866654251,
   0.0029086225531551409584007243428554808066729964599463206185935272835507710401075371030889534746865396796712229961775201041637525208319912384405887138057352162245263117236613745907325298881366403327115219447579691089142464776280578769352296965930400516951643315492273864484850375720177732566,
   0.0029086225531551409584007243428554808066729964599463206185935272835507710401075371030889534746865396796712229961775201041637525208319912384405887138057352162245263117236613745907325298881366403327115219447579691089142464776280578769352296965930400516951643315492273864484850375720177732566};
-#elif LEGENDRE_GAUSS_N == 51
-constexpr std::array<double, 51> weights {
+constexpr std::array<double, 51> weights_51 {
   0.0609989248412058801597976430983560505571218015265784498133193935942038702823987616285677103842995448522486381101517834480189836398012230864292065037499218652472708868774182983372492983789457461338910808391805914043653052759413803711578974562773671110449683070432106372441247505781002501689,
   0.0608854648448563438811986142226962197280760102802736523800265029098803820841648367003040997116065113941611794030080803498362624347072962648896652371269198147005057090665799266351549573281030379800610467383558796782274073974833885849428898380706307597982146456849257882146090476294917503166,
   0.0608854648448563438811986142226962197280760102802736523800265029098803820841648367003040997116065113941611794030080803498362624347072962648896652371269198147005057090665799266351549573281030379800610467383558796782274073974833885849428898380706307597982146456849257882146090476294917503166,
@@ -3656,8 +3539,7 @@ constexpr std::array<double, 51> weights {
   0.0065003377832526002921093751985375288330949430054258387850069991108191020576572811665791586375453352435123266418066005439175080618061000970694394305157444080510322133763342584264701036156830498023156932312443529017954956885131969553789401059766556232051949839721465644477790732324223798923,
   0.0027968071710898955755442168818090482242176996340115421697607130980002311146795916143678569713327143072158359963840709891900608518647681203984414320456917591287811695606427488049277290651814941097543924809140321406760945798292932512933757933402199319136660432307764880590859654938748712827,
   0.0027968071710898955755442168818090482242176996340115421697607130980002311146795916143678569713327143072158359963840709891900608518647681203984414320456917591287811695606427488049277290651814941097543924809140321406760945798292932512933757933402199319136660432307764880590859654938748712827};
-#elif LEGENDRE_GAUSS_N == 52
-constexpr std::array<double, 52> weights {
+constexpr std::array<double, 52> weights_52 {
   0.0598103657452918602477853788114774609444808036304140629325763147494409627007561314224986700920387512738748661058225913926132806166386309214648609095408936827797681268874365424207727560494038340010899611623484002444168317935229831928830660737233309024163341991925083948276975075418597182184,
   0.0598103657452918602477853788114774609444808036304140629325763147494409627007561314224986700920387512738748661058225913926132806166386309214648609095408936827797681268874365424207727560494038340010899611623484002444168317935229831928830660737233309024163341991925083948276975075418597182184,
   0.0595962601712481582583108787484149536622772803819419155385807811216201226945312370453016085924124041913655969475888970336516472766944360191070440778622130055980643117806358306246070809996428738830980591743489182188630823692728480750828752194633845671794229920133736266643897743311156360822,
@@ -3710,8 +3592,7 @@ constexpr std::array<double, 52> weights {
   0.0062555239629732768997161021698145466164117046531312593637996623530438086155010908361570458459841218235499508799472826835435947281935169075964914299326714594085849416341139097380181971907657093594675044511556800058016601378653224730341471696059704124436569989830746178759641020487686700605,
   0.0026913169500471111189521798688452180236693737610649004187705478912990016015308627461767975605648407160144053057363972991051243846452097128309826900511804375118685699114698551814655200176578845294097944721816599040263017197897391786286354331380214779373747979259616402732789341020739037078,
   0.0026913169500471111189521798688452180236693737610649004187705478912990016015308627461767975605648407160144053057363972991051243846452097128309826900511804375118685699114698551814655200176578845294097944721816599040263017197897391786286354331380214779373747979259616402732789341020739037078};
-#elif LEGENDRE_GAUSS_N == 53
-constexpr std::array<double, 53> weights {
+constexpr std::array<double, 53> weights_53 {
   0.0587187941511643645254869444421341262749937170978526622624477181483543130094717876267878564895500068638235377179958784063522006984772186634761745767674577157809257665064218863310509443989566740996943690242592805829134159722839062027806887581965114518567441446225851061260638396451345946802,
   0.0586175862327202633180719370499889415345994806622769869303281968383192556434419073432049336755089037479587315046392960181504494178937528397472206203817074103209216447135401361371775209362415860557869173511943568181606909740116196020185515967338839324676323345480444198469357266893686033551,
   0.0586175862327202633180719370499889415345994806622769869303281968383192556434419073432049336755089037479587315046392960181504494178937528397472206203817074103209216447135401361371775209362415860557869173511943568181606909740116196020185515967338839324676323345480444198469357266893686033551,
@@ -3765,8 +3646,7 @@ constexpr std::array<double, 53> weights {
   0.0060242762269486732812417068162998591009541520744844175589171064404736000339093233247159454567670350442702808800327635159458953167079402211168922931983137170160550383553335911686418385034390549347637713462869335522820434361767410697192058307187379560969785653712295822518380326944987769013,
   0.0025916837205670318115992394385109309847629976930227696753765003810516340052241262502142336096860776481698360300376895998888425117501553400761576430067185014988529484489739255625191520594500331871058438373587890001467842691175949013685401515836694590686646370802118003407044313301761850445,
   0.0025916837205670318115992394385109309847629976930227696753765003810516340052241262502142336096860776481698360300376895998888425117501553400761576430067185014988529484489739255625191520594500331871058438373587890001467842691175949013685401515836694590686646370802118003407044313301761850445};
-#elif LEGENDRE_GAUSS_N == 54
-constexpr std::array<double, 54> weights {
+constexpr std::array<double, 54> weights_54 {
   0.0576175367071470246723761288058714771729017447215605722859442062665796719680985046628988127458997371135427516038083172476005467345044310992727778227116826443562572871376912662542338761214025311600631999363529080767239030486376541318717728419172026213498009790791006877315588298883765020779,
   0.0576175367071470246723761288058714771729017447215605722859442062665796719680985046628988127458997371135427516038083172476005467345044310992727778227116826443562572871376912662542338761214025311600631999363529080767239030486376541318717728419172026213498009790791006877315588298883765020779,
   0.0574261370541121148592901317732068293892190570504253857096688442009648104578952350458007159569888465330850838234008145777880881795151703433905632526756620336346862506398302344716812552232521426002383725104356791139048700057965842599831728584581474861242314792424472521156218224657218100612,
@@ -3821,8 +3701,7 @@ constexpr std::array<double, 54> weights {
   0.0058056110152399848788258877458752734115246519894036667893391415546441823538923058395996755173116828647476661360911741304353188451368713627678514117420178606399751252774930779087299882322140091392697873394058832035466909921751983043690398873068750694127819603752551351369403947776734388285,
   0.0024974818357615857759460387572660298791850974668271119420965993271124253900170239132106061039837691066140669207046480118804664131403060355308436373993496150700319572201797805703364896736694457126329658353923979555994188902753162778430390809867011309206871019667563954854631726675431977796,
   0.0024974818357615857759460387572660298791850974668271119420965993271124253900170239132106061039837691066140669207046480118804664131403060355308436373993496150700319572201797805703364896736694457126329658353923979555994188902753162778430390809867011309206871019667563954854631726675431977796};
-#elif LEGENDRE_GAUSS_N == 55
-constexpr std::array<double, 55> weights {
+constexpr std::array<double, 55> weights_55 {
   0.0566029764445604254401057619812440040389691501015994588949743954117689840448329694941201287681083702528626234663391674158423197476891139248583553936707129584189023256637111472863948938404488137767632330825586982412481061074974778470441284029424883945832284051965150973433395558364338770537,
   0.056512318249772001400658367635189054139688183158251915624043595765616773464182815081551016669980317685607520056520168906188711392803952678188678624062744723125863502972512329138319220995604645301482414685322774852991574341616784516471096361218057184297890221191189607147255359399107020936,
   0.056512318249772001400658367635189054139688183158251915624043595765616773464182815081551016669980317685607520056520168906188711392803952678188678624062744723125863502972512329138319220995604645301482414685322774852991574341616784516471096361218057184297890221191189607147255359399107020936,
@@ -3878,8 +3757,7 @@ constexpr std::array<double, 55> weights {
   0.0055986322665607673540834168718598572451512952416667599970618743370212348836615028432017475417801098170871468960854439567681170125587012725583184157209377149799529442158500205590875263871609053466101397590019634349240984537270361621061661822274786864812120608369060950545553971790610581795,
   0.0024083236199797888191701934891252787041696275417057055223107771301828795545657361609550761004331278197304290504592301978266533965708886676595706495146706349365293711929104632515974226597208162382678181417262966962227616788235074955995719727372045272286725218109993129260733795022142594236,
   0.0024083236199797888191701934891252787041696275417057055223107771301828795545657361609550761004331278197304290504592301978266533965708886676595706495146706349365293711929104632515974226597208162382678181417262966962227616788235074955995719727372045272286725218109993129260733795022142594236};
-#elif LEGENDRE_GAUSS_N == 56
-constexpr std::array<double, 56> weights {
+constexpr std::array<double, 56> weights_56 {
   0.0555797463065143958462734268351611701440666225563429590041722087536575657676605290578769236934478825764575827238433812255402834246786504369631690557901054301072767154137193675124957294729080492091186354138602138418643743287270814292165715733247893174212845722614574322459415150441263482667,
   0.0555797463065143958462734268351611701440666225563429590041722087536575657676605290578769236934478825764575827238433812255402834246786504369631690557901054301072767154137193675124957294729080492091186354138602138418643743287270814292165715733247893174212845722614574322459415150441263482667,
   0.0554079525032451232177933918439100189095620313806630179957929486883879579564261910950875741108669609647856709082670065064451181974142128748237654741473991286096153170533874594871091658505162157945269495132672635052302004585440512656930682990219718049066752816617513723202797546274389960321,
@@ -3936,8 +3814,7 @@ constexpr std::array<double, 56> weights {
   0.005402522246015337761311260944120872841627818184113977357585577929434577630521026438567727368682064790346756160855269481961311582831994842270185477590712037413710044614728607475510728487696477083184510172719750604236744011736898322126500073998400348501530997944414211557079604789733883764,
   0.0023238553757732155011022764433958647375932099173585940305072914525535388352765996767275138868460803515403739407429607254311669872011703189408037822149937348621928206516982526237302505513526932985650370147814815645272653351247996908038576668653178722165906866311563185914575164931998434821,
   0.0023238553757732155011022764433958647375932099173585940305072914525535388352765996767275138868460803515403739407429607254311669872011703189408037822149937348621928206516982526237302505513526932985650370147814815645272653351247996908038576668653178722165906866311563185914575164931998434821};
-#elif LEGENDRE_GAUSS_N == 57
-constexpr std::array<double, 57> weights {
+constexpr std::array<double, 57> weights_57 {
   0.0546343287565840240628413879880520765362287641485429064618774096679924696720825461168238608238805321985156008588610738738324145056180551764714689179905681248389281912223447700492872844209441305029022772997550254492317823185940567954233261531633252094222850965516378409568214364737016431027,
   0.0545528036047618864801389953641965144760153482295025390859438500282864325898553145783777242388713147579747772714846767912494387503179971369564089501571381845430675654372921626543581470461388767331934110504877072977636510056707512059264202964970149348819326875158900199020898781626048049782,
   0.0545528036047618864801389953641965144760153482295025390859438500282864325898553145783777242388713147579747772714846767912494387503179971369564089501571381845430675654372921626543581470461388767331934110504877072977636510056707512059264202964970149348819326875158900199020898781626048049782,
@@ -3995,8 +3872,7 @@ constexpr std::array<double, 57> weights {
   0.0052165334747187793905066298714200853230314153904276446206733187014234652550989862183206965931682321144683498399927997031218799161482010680983331327529586150906389575306598460060023597705009281621472973018087391062319151804097892441030396423357829819469305997366715674338990001348518388683,
   0.0022437538722506629097347868226350138862675186051545391915377904189740743041602766973121578228429461964982335623126431060935398437416160929656053957278622826968206951802734438882186541437111471239795017417958531179188074641984691441572658332199905171411283353139593209035246224418421809475,
   0.0022437538722506629097347868226350138862675186051545391915377904189740743041602766973121578228429461964982335623126431060935398437416160929656053957278622826968206951802734438882186541437111471239795017417958531179188074641984691441572658332199905171411283353139593209035246224418421809475};
-#elif LEGENDRE_GAUSS_N == 58
-constexpr std::array<double, 58> weights {
+constexpr std::array<double, 58> weights_58 {
   0.0536811198633348488639059553057246129006819920023619436266546277365746951184024215662863270361444228616577791920269209979026882413734502759767811966272603907351760906888185636252247580024253426867047146155263601267170030275715233858982225935331860502650002689089209990806341152633689234565,
   0.0536811198633348488639059553057246129006819920023619436266546277365746951184024215662863270361444228616577791920269209979026882413734502759767811966272603907351760906888185636252247580024253426867047146155263601267170030275715233858982225935331860502650002689089209990806341152633689234565,
   0.0535263433040582521006108138861701805419674894903239215017231698378237154217128166364725770644050021619549459851418074512897756878582502782264612297844645443094248010923186018306135543165122457290483163247402986043545659487360375759012719449517746072125664654672731066876392646778741570446,
@@ -4055,8 +3931,7 @@ constexpr std::array<double, 58> weights {
   0.0050399816126502430850175011746224235533308794367412626183057067988306844939330904814942942981191070614586563512888622281125741136822167764332722371374240470636166310122625148106107438365704044170148215977150733042520853574211499564243835605166328567788896440118782299166688538833904944159,
   0.0021677232496274499430543429249845114310354402245786183237694727158732992949895875797870335750639552085569158721944413597419566074847757770480043132689610034167511849858747187769571178278754932668378526219042082696124155182919622210250260243090158709370161703597746750537506836531543034424,
   0.0021677232496274499430543429249845114310354402245786183237694727158732992949895875797870335750639552085569158721944413597419566074847757770480043132689610034167511849858747187769571178278754932668378526219042082696124155182919622210250260243090158709370161703597746750537506836531543034424};
-#elif LEGENDRE_GAUSS_N == 59
-constexpr std::array<double, 59> weights {
+constexpr std::array<double, 59> weights_59 {
   0.0527980126219904214155123324308552672990156744026711684394586630632366182065170023375453800090589228140782767277244046284321293872160694092645853031083801125992974533961412830927326701499730120688776963046181860417166663946424610915840474516637247930182611504739183271987208596085987725933,
   0.0527244338591279319613042488706125028718839375035442669792246394813498131794767671877846873796404368243789948825075646937646861763080460652954359289041171873855207977850852108952249246859377070870714979155557498725252197506449257376006751637156584031067665114311446749403779651746834432358,
   0.0527244338591279319613042488706125028718839375035442669792246394813498131794767671877846873796404368243789948825075646937646861763080460652954359289041171873855207977850852108952249246859377070870714979155557498725252197506449257376006751637156584031067665114311446749403779651746834432358,
@@ -4116,8 +3991,7 @@ constexpr std::array<double, 59> weights {
   0.004872239168265284768582001132924068556042660628866340612558980839897775434902911077162207955316960588750049817670063710437810482691483084639352549409496490317077795558887461821063218886048325970131840571697822619766073986937459465375156310711856748820479518507395344892382959044748016272,
   0.0020954922845412234027007314886400597679812932103771363545810426040686055402518735402223012495768268356585555685402636363012629581278380773547045289727030304360265925637488367848692620803494377305977659651853165248656984253669426160122843919885660078187915848792092068100777593030154453388,
   0.0020954922845412234027007314886400597679812932103771363545810426040686055402518735402223012495768268356585555685402636363012629581278380773547045289727030304360265925637488367848692620803494377305977659651853165248656984253669426160122843919885660078187915848792092068100777593030154453388};
-#elif LEGENDRE_GAUSS_N == 60
-constexpr std::array<double, 60> weights {
+constexpr std::array<double, 60> weights_60 {
   0.05190787763122063973286493836226968018015159556564093559948752392081555288767573079019510370214461670947671320553848830841968031169277510980885423005891900948537539828989292873461106827250350148840147264646051654588142238292472705529850682699118346595501809371086974085939650565286889301,
   0.05190787763122063973286493836226968018015159556564093559948752392081555288767573079019510370214461670947671320553848830841968031169277510980885423005891900948537539828989292873461106827250350148840147264646051654588142238292472705529850682699118346595501809371086974085939650565286889301,
   0.0517679431749101875438036430288237329323469454992015640732585368884643718987751611643078246617947454703322217387470328915308422758530219507738476209294827466646925495393935722141010143159098751671740343791002371786118623385220831214529729922246350005304345584360918409762135856942364340974,
@@ -4178,8 +4052,7 @@ constexpr std::array<double, 60> weights {
   0.0047127299269535686408948217140772359480849701937150601152906186225480882505601394477170957880565671129309110906775306664417201901869251742030783500316324243243873428307119067394672208720559189299768538876023030797017540286922629299187788560338780278837507761101941206829571277476765073597,
   0.0020268119688737584964317102098923246953116682255589499073453876573026786786685852087108358977534690314985505155616070442459531204767887941731198536540228209647396387220676389097266397170810063248409422221516967208851011406521565992160730534250788019845730172747636792675085819665498759834,
   0.0020268119688737584964317102098923246953116682255589499073453876573026786786685852087108358977534690314985505155616070442459531204767887941731198536540228209647396387220676389097266397170810063248409422221516967208851011406521565992160730534250788019845730172747636792675085819665498759834};
-#elif LEGENDRE_GAUSS_N == 61
-constexpr std::array<double, 61> weights {
+constexpr std::array<double, 61> weights_61 {
   0.0510811194407862179779210956063098528020576264040892787911989215339026674397907036858810448891728358319488836925041270256263546879811475069477310108009052419665334136592605802563390520128736477957430009934494678178392902501243912737711826998090323178892072404477575861100228687425303900393,
   0.0510144870386972635437350805738520107682023754233863468132722169457821888257760004865944543706219914094947622430581014359256379586977406038957614126246323715609450191971192770178095700839859602208525779271541310536698042795839586164231971243583246808719785636750241645328927588304595289465,
   0.0510144870386972635437350805738520107682023754233863468132722169457821888257760004865944543706219914094947622430581014359256379586977406038957614126246323715609450191971192770178095700839859602208525779271541310536698042795839586164231971243583246808719785636750241645328927588304595289465,
@@ -4241,8 +4114,7 @@ constexpr std::array<double, 61> weights {
   0.0045609240060124171845389325797427882708130433783153315119863842162342648514607188519930191965073273295385088143313152435053433740785070657599820738383966227333687432700831784490967075733640344370020531790406071999965232855465005951209834575185411385135657779501612620526902157496172341101,
   0.0019614533616702826717730644619268480941492940618714977619951789484200766093530110457319661058504881711288034229108966276376768237565974618076894377095927204747130915090302767611476967576504032393016502089842859507540593107325073889814466714504405980896381948328713349619411506796710466583,
   0.0019614533616702826717730644619268480941492940618714977619951789484200766093530110457319661058504881711288034229108966276376768237565974618076894377095927204747130915090302767611476967576504032393016502089842859507540593107325073889814466714504405980896381948328713349619411506796710466583};
-#elif LEGENDRE_GAUSS_N == 62
-constexpr std::array<double, 62> weights {
+constexpr std::array<double, 62> weights_62 {
   0.0502480003752562816884029489951356683165047234765657809277888839149221270392553521737320491221112629460156198792987742656329511335721298065618698328283544072512266544996390648541601370858143841930437125958455321558993923352245503880594157722203010133741035223321257611451522823409003975913,
   0.0502480003752562816884029489951356683165047234765657809277888839149221270392553521737320491221112629460156198792987742656329511335721298065618698328283544072512266544996390648541601370858143841930437125958455321558993923352245503880594157722203010133741035223321257611451522823409003975913,
   0.0501210695690432880748041001015309680048953199339213610412642652528031717303841255976903847048097341439124013302725077000284015491648695544180380842251962799078563253537094952691478038526606634486051024849779778891992515506390807113605753208878940855529853463965796005321762139252670600639,
@@ -4305,8 +4177,7 @@ constexpr std::array<double, 62> weights {
   0.0044163334569309048132741242554906407297119821304948961652056465309007875422747796794132360182852263374611690448605941746335350949912745684534260131702633743716697036950269939953443215067767151236108631185100307884853344735039052624020858568145313816000475291175773584932525111572039079856,
   0.0018992056795136904803973438609351401708788497723689766323043389586840178664991372359676292042154689399109826635545316632021362654038480930349585832711542954748274863305715006989063809604407912683714245476695695056237767588405334026461240889424980139491099726075305138922032106434270118558,
   0.0018992056795136904803973438609351401708788497723689766323043389586840178664991372359676292042154689399109826635545316632021362654038480930349585832711542954748274863305715006989063809604407912683714245476695695056237767588405334026461240889424980139491099726075305138922032106434270118558};
-#elif LEGENDRE_GAUSS_N == 63
-constexpr std::array<double, 63> weights {
+constexpr std::array<double, 63> weights_63 {
   0.0494723666239310208886693604209259446135322539423832672394478847005094113475826316373209212784027162857171854154663301301354768003526155244915792404934945200603059818861672135312086963813268586865296285761702580730093806302540085805937078100443235651212175944271051048140407930073788912347,
   0.0494118330399181789670396461167048596977283900845409695999168819552883288857412541148663128235434088567957421345218802238366935143609276080815790255294371569215535650737683451104307796936431427242673299970243844127238869083843212426818685867377051156326574147875106505183639461742481689263,
   0.0494118330399181789670396461167048596977283900845409695999168819552883288857412541148663128235434088567957421345218802238366935143609276080815790255294371569215535650737683451104307796936431427242673299970243844127238869083843212426818685867377051156326574147875106505183639461742481689263,
@@ -4370,8 +4241,7 @@ constexpr std::array<double, 63> weights {
   0.0042785083468637618660784110826227855171274726708752114023382155682336219708787539858760566988334813241561808983571636597369267389143258934319275371524633920044257144989413319034792634199846320150240581276985932832361337249577300867129706338744356129982737921628062083956210285551010068079,
   0.001839874595577084117092445554043923852638472338840242480644268938179143365018867962253657842862216746234732064570567791920709164837809912130901242475071173700371687117847082761312423427971215542793653079569012275971565849946358063576169833245596591756944387094396387917668015963157767852,
   0.001839874595577084117092445554043923852638472338840242480644268938179143365018867962253657842862216746234732064570567791920709164837809912130901242475071173700371687117847082761312423427971215542793653079569012275971565849946358063576169833245596591756944387094396387917668015963157767852};
-#elif LEGENDRE_GAUSS_N == 64
-constexpr std::array<double, 64> weights {
+constexpr std::array<double, 64> weights_64 {
   0.0486909570091397203833653907347499124426286922838743305086688042456914190998246107310291565645676057401607079939845156005172257043376703767287395573765236401039685866479381075274920900511719320271157129622463682509122641788910270632229694394595885032921037399187298767076084601033342936131,
   0.0486909570091397203833653907347499124426286922838743305086688042456914190998246107310291565645676057401607079939845156005172257043376703767287395573765236401039685866479381075274920900511719320271157129622463682509122641788910270632229694394595885032921037399187298767076084601033342936131,
   0.0485754674415034269347990667839781136875565447049294857111516761025158193093697039229163427633930410186232149083923688162761488505704450697417589593116703853157329164894580165517236877241308351214870169600093357854651930986960906313726182992933363325614247750209880050786299287510692780499,
@@ -4436,7 +4306,141 @@ constexpr std::array<double, 64> weights {
   0.0041470332605624676352875357285514153133028192536848024628763661431834776690157393776820933106187137592011723199002845429836606307797425496666456172753165824787973801175029578301513761259541022471768825518482406145696380621686627285992715643614469568410535180218496973657001203470470418364,
   0.0017832807216964329472960791449719331799593472719279556695308063655858546954239803486698215802150348282744786016134857283616955449868451969230490863774274598030023211055562492709717566919237924255297982774711177411074145151155610163293142044147991553384925940046957893721166251082473659733,
   0.0017832807216964329472960791449719331799593472719279556695308063655858546954239803486698215802150348282744786016134857283616955449868451969230490863774274598030023211055562492709717566919237924255297982774711177411074145151155610163293142044147991553384925940046957893721166251082473659733};
-#endif // WEIGHTS
+
+/*!
+ * \brief Abcissae and weights of a Legendre-Gauss quadrature with n points
+ */
+struct Rule
+{
+  unsigned n;
+  const double* abcissae;
+  const double* weights;
+};
+
+/// Maximal number of points with available quadrature
+constexpr unsigned max_N = 64;
+
+/*!
+ * \brief Get a Legendre-Gauss quadrature with n points
+ * \param n Number of points, 1 <= n <= max_N
+ * \return Quadrature rule
+ */
+inline const Rule& rule(unsigned n)
+{
+  static const std::array<Rule, max_N> rules{{
+    Rule{1, abcissae_1.data(), weights_1.data()},
+    Rule{2, abcissae_2.data(), weights_2.data()},
+    Rule{3, abcissae_3.data(), weights_3.data()},
+    Rule{4, abcissae_4.data(), weights_4.data()},
+    Rule{5, abcissae_5.data(), weights_5.data()},
+    Rule{6, abcissae_6.data(), weights_6.data()},
+    Rule{7, abcissae_7.data(), weights_7.data()},
+    Rule{8, abcissae_8.data(), weights_8.data()},
+    Rule{9, abcissae_9.data(), weights_9.data()},
+    Rule{10, abcissae_10.data(), weights_10.data()},
+    Rule{11, abcissae_11.data(), weights_11.data()},
+    Rule{12, abcissae_12.data(), weights_12.data()},
+    Rule{13, abcissae_13.data(), weights_13.data()},
+    Rule{14, abcissae_14.data(), weights_14.data()},
+    Rule{15, abcissae_15.data(), weights_15.data()},
+    Rule{16, abcissae_16.data(), weights_16.data()},
+    Rule{17, abcissae_17.data(), weights_17.data()},
+    Rule{18, abcissae_18.data(), weights_18.data()},
+    Rule{19, abcissae_19.data(), weights_19.data()},
+    Rule{20, abcissae_20.data(), weights_20.data()},
+    Rule{21, abcissae_21.data(), weights_21.data()},
+    Rule{22, abcissae_22.data(), weights_22.data()},
+    Rule{23, abcissae_23.data(), weights_23.data()},
+    Rule{24, abcissae_24.data(), weights_24.data()},
+    Rule{25, abcissae_25.data(), weights_25.data()},
+    Rule{26, abcissae_26.data(), weights_26.data()},
+    Rule{27, abcissae_27.data(), weights_27.data()},
+    Rule{28, abcissae_28.data(), weights_28.data()},
+    Rule{29, abcissae_29.data(), weights_29.data()},
+    Rule{30, abcissae_30.data(), weights_30.data()},
+    Rule{31, abcissae_31.data(), weights_31.data()},
+    Rule{32, abcissae_32.data(), weights_32.data()},
+    Rule{33, abcissae_33.data(), weights_33.data()},
+    Rule{34, abcissae_34.data(), weights_34.data()},
+    Rule{35, abcissae_35.data(), weights_35.data()},
+    Rule{36, abcissae_36.data(), weights_36.data()},
+    Rule{37, abcissae_37.data(), weights_37.data()},
+    Rule{38, abcissae_38.data(), weights_38.data()},
+    Rule{39, abcissae_39.data(), weights_39.data()},
+    Rule{40, abcissae_40.data(), weights_40.data()},
+    Rule{41, abcissae_41.data(), weights_41.data()},
+    Rule{42, abcissae_42.data(), weights_42.data()},
+    Rule{43, abcissae_43.data(), weights_43.data()},
+    Rule{44, abcissae_44.data(), weights_44.data()},
+    Rule{45, abcissae_45.data(), weights_45.data()},
+    Rule{46, abcissae_46.data(), weights_46.data()},
+    Rule{47, abcissae_47.data(), weights_47.data()},
+    Rule{48, abcissae_48.data(), weights_48.data()},
+    Rule{49, abcissae_49.data(), weights_49.data()},
+    Rule{50, abcissae_50.data(), weights_50.data()},
+    Rule{51, abcissae_51.data(), weights_51.data()},
+    Rule{52, abcissae_52.data(), weights_52.data()},
+    Rule{53, abcissae_53.data(), weights_53.data()},
+    Rule{54, abcissae_54.data(), weights_54.data()},
+    Rule{55, abcissae_55.data(), weights_55.data()},
+    Rule{56, abcissae_56.data(), weights_56.data()},
+    Rule{57, abcissae_57.data(), weights_57.data()},
+    Rule{58, abcissae_58.data(), weights_58.data()},
+    Rule{59, abcissae_59.data(), weights_59.data()},
+    Rule{60, abcissae_60.data(), weights_60.data()},
+    Rule{61, abcissae_61.data(), weights_61.data()},
+    Rule{62, abcissae_62.data(), weights_62.data()},
+    Rule{63, abcissae_63.data(), weights_63.data()},
+    Rule{64, abcissae_64.data(), weights_64.data()}}};
+  if (n == 0 || n > max_N)
+    throw std::invalid_argument{"Legendre-Gauss quadrature is available for 1 to 64 points."};
+  return rules[n - 1];
+}
+
+#define LEGENDRE_GAUSS_CONCAT_(name, n) name##n
+#define LEGENDRE_GAUSS_CONCAT(name, n) LEGENDRE_GAUSS_CONCAT_(name, n)
+
+/// Number of points of default quadrature, set with LEGENDRE_GAUSS_N at compile time
+constexpr int N = LEGENDRE_GAUSS_N;
+/// Abcissae of default quadrature
+static constexpr const std::array<double, N>& abcissae = LEGENDRE_GAUSS_CONCAT(abcissae_, LEGENDRE_GAUSS_N);
+/// Weights of default quadrature
+static constexpr const std::array<double, N>& weights = LEGENDRE_GAUSS_CONCAT(weights_, LEGENDRE_GAUSS_N);
+
+#undef LEGENDRE_GAUSS_CONCAT
+#undef LEGENDRE_GAUSS_CONCAT_
+
+/*
+ * Gauss-Kronrod 7-15 rule used for adaptive quadrature
+ *
+ * Nodes and weights taken from QUADPACK (qk15), only nonnegative abcissae are listed.
+ * Gauss weights belong to Kronrod abcissae with odd indices.
+ */
+constexpr std::array<double, 8> kronrod_abcissae {
+  0.991455371120812639206854697526329,
+  0.949107912342758524526189684047851,
+  0.864864423359769072789712788640926,
+  0.741531185599394439863864773280788,
+  0.586087235467691130294144845693013,
+  0.405845151377397166906606412076961,
+  0.207784955007898467600689403773245,
+  0.000000000000000000000000000000000};
+
+constexpr std::array<double, 8> kronrod_weights {
+  0.022935322010529224963732008058970,
+  0.063092092629978553290700663189204,
+  0.104790010322250183839876322541518,
+  0.140653259715525918745189590510238,
+  0.169004726639267902826583426598550,
+  0.190350578064785409913256402421014,
+  0.204432940075298892414161999234649,
+  0.209482141084727828012999174891714};
+
+constexpr std::array<double, 4> gauss_weights {
+  0.129484966168869693270611432679082,
+  0.279705391489276667901467771423780,
+  0.381830050505118944950369775488975,
+  0.417959183673469387755102040816327};
 }
 
 #endif // LEGENDRE_GAUSS_H
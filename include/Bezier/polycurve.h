@@ -17,6 +17,7 @@
 #ifndef POLYCURVE_H
 #define POLYCURVE_H
 
+#include <atomic>
 #include <deque>
 
 #include "declarations.h"
@@ -32,32 +33,57 @@ namespace Bezier
  *
  * \warning Range of parameter 't' depends on number of subcurves.
  * To access n-th subcurve, t has to be in range [n-1, n>
+ *
+ * \tparam Scalar Floating point type of coordinates and parameters
  */
-class PolyCurve
+template <typename Scalar> class PolyCurveT
 {
 public:
+  /// Bezier curve of the same scalar type
+  using Curve = CurveT<Scalar>;
+  /// Point in xy plane
+  using Point = PointT<Scalar>;
+  /// A Vector in xy plane
+  using Vector = VectorT<Scalar>;
+  /// A vector of Points
+  using PointVector = PointVectorT<Scalar>;
+  /// Bounding box class
+  using BoundingBox = BoundingBoxT<Scalar>;
+  /// Mx2 matrix where each row is a point
+  using MatrixX2 = Eigen::Matrix<Scalar, Eigen::Dynamic, 2>;
+  /// A vector of parameters
+  using VectorX = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+  /// Curvature based measures of path quality
+  using Functionals = typename Curve::Functionals;
+
   /*!
    * \brief Create the empty Bezier polycurve
    */
-  PolyCurve() = default;
+  PolyCurveT() = default;
 
   /*!
    * \brief Create the Bezier polycurve with only one subcurve
    * \param curve A single curve
    */
-  PolyCurve(std::shared_ptr<Curve>& curve);
+  PolyCurveT(std::shared_ptr<Curve>& curve);
 
   /*!
    * \brief Create the Bezier polycurve from vector of curves
    * \param curve_list A list of curves
    */
-  PolyCurve(std::vector<std::shared_ptr<Curve>>& curve_list);
+  PolyCurveT(std::vector<std::shared_ptr<Curve>>& curve_list);
 
   /*!
    * \brief Create a copy of Bezier polycurve
    * \param polycurve A Bezier polycurve to copy
    */
-  PolyCurve(const PolyCurve& poly_curve);
+  PolyCurveT(const PolyCurveT& poly_curve);
+
+  /*!
+   * \brief Assign a copy of Bezier polycurve
+   * \param polycurve A Bezier polycurve to copy
+   */
+  PolyCurveT& operator=(const PolyCurveT& poly_curve);
 
   /*!
    * \brief Insert new curve into polycurve
@@ -99,7 +125,7 @@ public:
    * \param idx_l Index of first subcurve (start)
    * \param idx_r Index of last subcurve (end)
    */
-  PolyCurve subPolyCurve(uint idx_l, uint idx_r) const;
+  PolyCurveT subPolyCurve(uint idx_l, uint idx_r) const;
 
   /*!
    * \brief Get number of subcurves
@@ -112,15 +138,22 @@ public:
    * \param t A polycurve parameter
    * \return An index of of subcurve where parameter t is
    */
-  uint curveIdx(double t) const;
+  uint curveIdx(Scalar t) const;
 
   /*!
    * \brief Get pointer of a subcurve
    * \param idx Subcurve index
    * \return A shared pointer
+   * \note Modifications of subcurve through the pointer are detected, cached data is updated on next query
    */
   std::shared_ptr<Curve> curvePtr(uint idx) const;
 
+  /*!
+   * \brief Reset cached data of polycurve from a subcurve onward
+   * \param idx Index of first modified subcurve
+   */
+  void resetCache(uint idx = 0);
+
   /*!
    * \brief Get list of all subcurves
    * \return A vector of pointers
@@ -133,31 +166,37 @@ public:
    * \param precision Minimal distance between two subsequent points
    * \return A vector of polyline vertices
    */
-  PointVector polyline(double smoothness = 1.0001, double precision = 1.0) const;
+  PointVector polyline(Scalar smoothness = 1.0001, Scalar precision = 1.0) const;
 
   /*!
    * \brief Compute exaxt arc length with Legendre-Gauss quadrature
    * \return Arc length
-   * \warning Precision depends on value of LEGENDRE_GAUSS_N at compile time
+   * \warning Precision depends on number of quadrature nodes of subcurves
    */
-  double length() const;
+  Scalar length() const;
 
   /*!
    * \brief Compute exact arc length with Legendre-Gauss quadrature
    * \param t A Polyurve parameter to which length is computed
    * \return Arc length from start to parameter t
-   * \warning Precision depends on value of LEGENDRE_GAUSS_N at compile time
+   * \warning Precision depends on number of quadrature nodes of subcurves
    */
-  double length(double t) const;
+  Scalar length(Scalar t) const;
 
   /*!
    * \brief Compute exact arc length with Legendre-Gauss quadrature
    * \param t1 A Polyurve parameter from which length is computed
    * \param t2 A Polyurve parameter to which length is computed
    * \return Arc length between paramaters t1 and t2
-   * \warning Precision depends on value of LEGENDRE_GAUSS_N at compile time
+   * \warning Precision depends on number of quadrature nodes of subcurves
    */
-  double length(double t1, double t2) const;
+  Scalar length(Scalar t1, Scalar t2) const;
+
+  /*!
+   * \brief Get arc lengths of all subcurves
+   * \return A vector where each element is arc length of corresponding subcurve
+   */
+  VectorX lengths() const;
 
   /*!
    * \brief Compute parameter t which is S distance from given t
@@ -167,7 +206,28 @@ public:
    * \param max_iter Maximum number of iterations for Newton-Rhapson
    * \return New parameter t
    */
-  double iterateByLength(double t, double s, double epsilon = 0.001, std::size_t max_iter = 15) const;
+  Scalar iterateByLength(Scalar t, Scalar s, Scalar epsilon = 0.001, std::size_t max_iter = 15) const;
+
+  /*!
+   * \brief Sample the polycurve at equal arc length distances
+   *
+   * Polycurve is traversed once, continuing across subcurve boundaries.
+   * \param spacing Arc length between two subsequent samples
+   * \param epsilon Precision of arc length of each sample
+   * \return Pair of vector of parameters t and Mx2 matrix of corresponding points
+   */
+  std::pair<VectorX, MatrixX2> resampleByLength(Scalar spacing, Scalar epsilon = 0.001) const;
+
+  /*!
+   * \brief Sample the polycurve at equal arc length distances into preallocated buffers
+   * \param spacing Arc length between two subsequent samples
+   * \param t_vector Buffer for parameters t of samples
+   * \param points Buffer for samples, Mx2 matrix where each row is a point
+   * \param epsilon Precision of arc length of each sample
+   * \return Number of samples on polycurve; if larger than size of buffers, only the first ones are written
+   */
+  uint resampleByLength(Scalar spacing, Eigen::Ref<VectorX> t_vector, Eigen::Ref<MatrixX2> points,
+                        Scalar epsilon = 0.001) const;
 
   /*!
    * \brief Get first and last control points
@@ -193,21 +253,35 @@ public:
    * \param t Curve parameter
    * \return Point on a polycurve for a given t
    */
-  Point valueAt(double t) const;
+  Point valueAt(Scalar t) const;
+
+  /*!
+   * \brief Get the points on polycurve for a vector of parameters t
+   * \param t_vector A vector of polycurve parameters
+   * \return Mx2 matrix where each row is a point on a polycurve for corresponding t
+   */
+  MatrixX2 valueAt(const VectorX& t_vector) const;
 
   /*!
    * \brief Get curvature of polycurve for a given t
    * \param t A Polyurve parameter
    * \return Curvature of a polycurve for a given t
    */
-  double curvatureAt(double t) const;
+  Scalar curvatureAt(Scalar t) const;
 
   /*!
    * \brief Get curvature derivative of curve for a given t
    * \param t Curve parameter
    * \return Curvature derivative of a curve for a given t
    */
-  double curvatureDerivativeAt(double t) const;
+  Scalar curvatureDerivativeAt(Scalar t) const;
+
+  /*!
+   * \brief Compute curvature based functionals of all subcurves
+   * \param intervals Number of uniform parameter intervals per subcurve
+   * \return Bending energy, curvature variation and maximal curvature of polycurve
+   */
+  Functionals functionals(uint intervals = 1) const;
 
   /*!
    * \brief Get the tangent of polycurve for a given t
@@ -215,7 +289,15 @@ public:
    * \param normalize If the resulting tangent should be normalized
    * \return Tangent of a polycurve for a given t
    */
-  Vector tangentAt(double t, bool normalize = true) const;
+  Vector tangentAt(Scalar t, bool normalize = true) const;
+
+  /*!
+   * \brief Get the tangents of polycurve for a vector of parameters t
+   * \param t_vector A vector of polycurve parameters
+   * \param normalize If the resulting tangents should be normalized
+   * \return Mx2 matrix where each row is a tangent of a polycurve for corresponding t
+   */
+  MatrixX2 tangentAt(const VectorX& t_vector, bool normalize = true) const;
 
   /*!
    * \brief Get the normal of polycurve for a given t
@@ -223,14 +305,29 @@ public:
    * \param normalize If the resulting normal should be normalized
    * \return Normal of a polycurve for given t
    */
-  Vector normalAt(double t, bool normalize = true) const;
+  Vector normalAt(Scalar t, bool normalize = true) const;
+
+  /*!
+   * \brief Get the normals of polycurve for a vector of parameters t
+   * \param t_vector A vector of polycurve parameters
+   * \param normalize If the resulting normals should be normalized
+   * \return Mx2 matrix where each row is a normal of a polycurve for corresponding t
+   */
+  MatrixX2 normalAt(const VectorX& t_vector, bool normalize = true) const;
 
   /*!
    * \brief Get value of a derivative for a given t
    * \param t Curve parameter
    * \return Derivative curve
    */
-  Point derivativeAt(double t) const;
+  Point derivativeAt(Scalar t) const;
+
+  /*!
+   * \brief Get values of a derivative for a vector of parameters t
+   * \param t_vector A vector of polycurve parameters
+   * \return Mx2 matrix where each row is a derivative for corresponding t
+   */
+  MatrixX2 derivativeAt(const VectorX& t_vector) const;
 
   /*!
    * \brief Get value of an nth derivative for a given t
@@ -238,7 +335,15 @@ public:
    * \param t Curve parameter
    * \return Derivative curve
    */
-  Point derivativeAt(uint n, double t) const;
+  Point derivativeAt(uint n, Scalar t) const;
+
+  /*!
+   * \brief Get values of an nth derivative for a vector of parameters t
+   * \param n Desired number of derivative
+   * \param t_vector A vector of polycurve parameters
+   * \return Mx2 matrix where each row is an nth derivative for corresponding t
+   */
+  MatrixX2 derivativeAt(uint n, const VectorX& t_vector) const;
 
   /*!
    * \brief Get the bounding box of polycurve
@@ -248,15 +353,30 @@ public:
   BoundingBox boundingBox(bool use_roots = true) const;
 
   /*!
-   * \brief Get the points of intersection with another curve or polycurve
+   * \brief Get the bounding boxes of all subcurves
+   * \param use_roots If algorithm should use roots
+   * \return A vector of bounding boxes, one for each subcurve
+   */
+  std::vector<BoundingBox> boundingBoxes(bool use_roots = true) const;
+
+  /*!
+   * \brief Get the points of intersection with another curve
    * \param curve Curve to intersect with
    * \param stop_at_first If first point of intersection is enough
    * \param epsilon Precision of resulting intersection
    * \return A vector af points of intersection between curves
    */
-  template <typename Curve_PolyCurve>
-  std::vector<Point> pointsOfIntersection(const Curve_PolyCurve& curve, bool stop_at_first = false,
-                                             double epsilon = 0.001) const;
+  PointVector pointsOfIntersection(const Curve& curve, bool stop_at_first = false, Scalar epsilon = 0.001) const;
+
+  /*!
+   * \brief Get the points of intersection with another polycurve
+   * \param poly_curve Polycurve to intersect with
+   * \param stop_at_first If first point of intersection is enough
+   * \param epsilon Precision of resulting intersection
+   * \return A vector af points of intersection between curves
+   */
+  PointVector pointsOfIntersection(const PolyCurveT& poly_curve, bool stop_at_first = false,
+                                   Scalar epsilon = 0.001) const;
 
   /*!
    * \brief Get the parameter t where polycurve is closest to given point
@@ -265,17 +385,85 @@ public:
    * \param epsilon Precision of resulting projection
    * \return Parameter t
    */
-  double projectPoint(const Point& point, double step = 0.01, double epsilon = 0.001) const;
+  Scalar projectPoint(const Point& point, Scalar step = 0.01, Scalar epsilon = 0.001) const;
 
 private:
   /// Structure for holding underlying Bezier curves
   std::deque<std::shared_ptr<Curve>> curves_;
 
+  /*!
+   * \brief Arc length from start of polycurve to start of each subcurve (and to the end, when complete)
+   *
+   * Subcurves are shared with copies and callers, so versions of subcurves are stored
+   * to detect modifications that were not made through this polycurve.
+   */
+  struct LengthsCache
+  {
+    std::vector<Scalar> lengths;        /*! Cumulative lengths, starting with 0 */
+    std::vector<std::size_t> versions;  /*! Version of each subcurve included in lengths */
+  };
+
+  /// Bounding box of each subcurve (empty if outdated) and their union (empty if any is outdated)
+  struct BoundingBoxesCache
+  {
+    std::vector<BoundingBox> boxes;     /*! Bounding box of each subcurve */
+    std::vector<std::size_t> versions;  /*! Version of each subcurve when its box was computed */
+    BoundingBox merged;                 /*! Union of all boxes */
+  };
+
+  /// Number of modifications of subcurves, incremented by the subcurves themselves
+  std::shared_ptr<std::atomic<std::size_t>> modifications_ = std::make_shared<std::atomic<std::size_t>>(0);
+  /// Value of modifications_ when versions in cached data were last checked, so unmodified caches are not scanned
+  mutable std::atomic<std::size_t> lengths_checked_{0}, bounding_boxes_tight_checked_{0},
+      bounding_boxes_relaxed_checked_{0};
+
+  // private caching, safe for concurrent readers
+  mutable std::shared_ptr<const LengthsCache>
+      cached_cumulative_lengths_; /*! If generated, stores cumulative lengths (atomic access only) */
+  mutable std::shared_ptr<const BoundingBoxesCache>
+      cached_bounding_boxes_tight_; /*! If generated, stores bounding boxes (use_roots = true), atomic access only */
+  mutable std::shared_ptr<const BoundingBoxesCache>
+      cached_bounding_boxes_relaxed_; /*! If generated, stores bounding boxes (use_roots = false), atomic access only */
+
+  /// Private getter function for cumulative lengths of subcurves
+  std::shared_ptr<const LengthsCache> cumulativeLengths() const;
+
+  /// Private function for resetting cumulative lengths from a subcurve onward
+  void resetLengthsCache(uint idx);
+
+  /// Private getter function for bounding boxes of subcurves, updating outdated ones
+  std::shared_ptr<const BoundingBoxesCache> boundingBoxesCache(bool use_roots) const;
+
+  /*!
+   * \brief Update cached bounding boxes for a modified, inserted or removed subcurve
+   * \param idx Index of subcurve
+   * \param change Subcurve idx is inserted (1), removed (-1) or modified (0)
+   */
+  void updateBoundingBoxes(uint idx, int change = 0);
+
+  /// Register this polycurve with a subcurve, so modifications of subcurve are counted
+  void watchCurve(Curve& curve);
+
+  /// Share cached data of other polycurve with the same subcurves
+  void copyCaches(const PolyCurveT& poly_curve);
+
   /*!
    * \brief Constructor for easier creation of sub-polycurve
    * \param curve_list A list of continuus sub-curves
    */
-  PolyCurve(std::deque<std::shared_ptr<Curve>>  curve_list);
+  PolyCurveT(std::deque<std::shared_ptr<Curve>>  curve_list);
+
+  /// Curves build polycurves from their own subcurves, which are continuous already
+  friend class CurveT<Scalar>;
+
+  /*!
+   * \brief Evaluate subcurves for a vector of parameters, grouped by subcurve index
+   * \param t_vector A vector of polycurve parameters
+   * \param evaluate Function evaluating one subcurve for a vector of its own parameters
+   * \return Mx2 matrix where each row is a result for corresponding t
+   */
+  template <typename Evaluate>
+  MatrixX2 evaluateGrouped(const VectorX& t_vector, Evaluate evaluate) const;
 };
 
 } // namespace Bezier
@@ -1,130 +1,569 @@
 #include "Bezier/bezier.h"
+#include "Bezier/bernstein_roots.h"
 #include "Bezier/legendre_gauss.h"
+#include "Bezier/polycurve.h"
 
+#include <algorithm>
 #include <numeric>
+#include <thread>
 
 #include <unsupported/Eigen/MatrixFunctions>
 
+#ifndef BEZIER_DEFAULT_EVALUATOR
+#define BEZIER_DEFAULT_EVALUATOR PowerBasis
+#endif
+
 inline double factorial(uint k) { return std::tgamma(k + 1); }
-inline double binomial(uint n, uint k) { return factorial(n) / (factorial(k) * factorial(n - k)); }
 
 using namespace Bezier;
 
-Curve::CoeffsMap Curve::bernstein_coeffs_ = CoeffsMap();
-Curve::CoeffsMap Curve::splitting_coeffs_left_ = CoeffsMap();
-Curve::CoeffsMap Curve::splitting_coeffs_right_ = CoeffsMap();
-Curve::CoeffsMap Curve::elevate_order_coeffs_ = CoeffsMap();
-Curve::CoeffsMap Curve::lower_order_coeffs_ = CoeffsMap();
+/// Stack storage for de Casteljau's algorithm, used for curves up to order 63
+template <typename Scalar> using DeCasteljauBuffer = Eigen::Matrix<Scalar, Eigen::Dynamic, 2, Eigen::RowMajor, 64, 2>;
 
-void Curve::resetCache()
+/*!
+ * \brief Replace control points with control points of subcurve for [0, t], using de Casteljau's algorithm
+ */
+template <typename Points> void deCasteljauLeft(Points& points, typename Points::Scalar t)
 {
-  cached_derivative_.reset();
-  cached_roots_.reset();
-  cached_bounding_box_tight_.reset();
-  cached_bounding_box_relaxed_.reset();
-  cached_polyline_.reset();
+  const Eigen::Index m = points.rows() - 1;
+  for (Eigen::Index r = 1; r <= m; r++)
+    for (Eigen::Index j = m; j >= r; j--)
+      points.row(j) = (1 - t) * points.row(j - 1) + t * points.row(j);
 }
 
-Curve::Coeffs Curve::bernsteinCoeffs() const
+/*!
+ * \brief Replace control points with control points of subcurve for [t, 1], using de Casteljau's algorithm
+ */
+template <typename Points> void deCasteljauRight(Points& points, typename Points::Scalar t)
 {
-  if (bernstein_coeffs_.find(N_) == bernstein_coeffs_.end())
+  const Eigen::Index m = points.rows() - 1;
+  for (Eigen::Index r = 1; r <= m; r++)
+    for (Eigen::Index j = 0; j + r <= m; j++)
+      points.row(j) = (1 - t) * points.row(j) + t * points.row(j + 1);
+}
+
+/*!
+ * \brief Write control points of subcurves for [0, t] and [t, 1], using de Casteljau's algorithm
+ *
+ * Right may share storage with points.
+ */
+template <typename Points, typename Left, typename Right>
+void deCasteljauSplit(const Points& points, typename Points::Scalar t, Left& left, Right& right)
+{
+  const Eigen::Index m = points.rows() - 1;
+  right = points;
+  for (Eigen::Index r = 0; r <= m; r++)
   {
-    bernstein_coeffs_.insert(std::make_pair(N_, Coeffs::Zero(N_, N_)));
-    bernstein_coeffs_.at(N_).diagonal(-1) = -Eigen::ArrayXd::LinSpaced(N_ - 1, 1, N_ - 1);
-    bernstein_coeffs_.at(N_) = bernstein_coeffs_.at(N_).exp();
-    for (uint k = 0; k < N_; k++)
-      bernstein_coeffs_.at(N_).row(k) *= binomial(N_ - 1, k);
+    // first point of each level belongs to the left subcurve, last point stays in place for the right one
+    left.row(r) = right.row(0);
+    for (Eigen::Index j = 0; j + r < m; j++)
+      right.row(j) = (1 - t) * right.row(j) + t * right.row(j + 1);
   }
-  return bernstein_coeffs_.at(N_);
 }
 
-Curve::Coeffs Curve::splittingCoeffsLeft(double z) const
+/*!
+ * \brief Replace control points with control points of subcurve for [t1, t2], where t1 < t2
+ *
+ * The split whose relative parameter for the second cut has a larger denominator is done first.
+ */
+template <typename Points>
+void deCasteljauInterval(Points& points, typename Points::Scalar t1, typename Points::Scalar t2)
 {
-  if (z == 0.5)
+  if (t1 == 0 && t2 == 1)
+    return;
+  if (std::fabs(t2) >= std::fabs(1 - t1))
   {
-    if (splitting_coeffs_left_.find(N_) == splitting_coeffs_left_.end())
-    {
-      splitting_coeffs_left_.insert(std::make_pair(N_, Coeffs::Zero(N_, N_)));
-      splitting_coeffs_left_.at(N_).diagonal() = Eigen::pow(0.5, Eigen::ArrayXd::LinSpaced(N_, 0, N_ - 1));
-      splitting_coeffs_left_.at(N_) = bernsteinCoeffs().inverse() * splitting_coeffs_left_.at(N_) * bernsteinCoeffs();
-    }
-    return splitting_coeffs_left_.at(N_);
+    deCasteljauLeft(points, t2);
+    deCasteljauRight(points, t1 / t2);
   }
   else
   {
-    Curve::Coeffs coeffs(Coeffs::Zero(N_, N_));
-    coeffs.diagonal() = Eigen::pow(z, Eigen::ArrayXd::LinSpaced(N_, 0, N_ - 1));
-    coeffs = bernsteinCoeffs().inverse() * coeffs * bernsteinCoeffs();
-    return coeffs;
+    deCasteljauRight(points, t1);
+    deCasteljauLeft(points, (t2 - t1) / (1 - t1));
   }
 }
 
-Curve::Coeffs Curve::splittingCoeffsRight(double z) const
+/*!
+ * \brief Find real roots of a polynomial of degree up to 3 analytically
+ * \param coeffs Coefficients in power basis, starting with the constant term
+ * \param degree Degree of polynomial (nearly zero leading coefficients lower it)
+ * \param roots Array of at least 3 elements to store roots
+ * \return Number of roots found (0 for a zero polynomial)
+ */
+template <typename Scalar> uint polynomialRoots(const Scalar* coeffs, uint degree, Scalar* roots)
 {
-  if (z == 0.5)
+  Scalar max_coeff = 0;
+  for (uint k = 0; k <= degree; k++)
+    max_coeff = std::max(max_coeff, std::fabs(coeffs[k]));
+  while (degree > 0 && std::fabs(coeffs[degree]) <= 16 * std::numeric_limits<Scalar>::epsilon() * max_coeff)
+    degree--;
+
+  uint count = 0;
+  if (degree == 1)
+    roots[count++] = -coeffs[0] / coeffs[1];
+  else if (degree == 2)
   {
-    if (splitting_coeffs_right_.find(N_) == splitting_coeffs_right_.end())
+    const Scalar a = coeffs[2], b = coeffs[1], c = coeffs[0];
+    const Scalar discriminant = b * b - 4 * a * c;
+    if (discriminant >= 0)
     {
-      splitting_coeffs_right_.insert(std::make_pair(N_, Coeffs::Zero(N_, N_)));
-      Curve::Coeffs temp_splitting_coeffs_left = splittingCoeffsLeft();
-      for (uint k = 0; k < N_; k++)
-        splitting_coeffs_right_.at(N_).block(k, k, 1, N_ - k) =
-            temp_splitting_coeffs_left.block(N_ - 1 - k, 0, 1, N_ - k);
+      // avoid cancellation between b and square root of discriminant
+      const Scalar q = -(b + std::copysign(std::sqrt(discriminant), b)) / 2;
+      roots[count++] = q / a;
+      if (q != 0)
+        roots[count++] = c / q;
     }
-    return splitting_coeffs_right_.at(N_);
   }
-  else
+  else if (degree == 3)
   {
-    Curve::Coeffs coeffs(Coeffs::Zero(N_, N_));
-    Curve::Coeffs temp_splitting_coeffs_left = splittingCoeffsLeft(z);
-    for (uint k = 0; k < N_; k++)
-      coeffs.block(k, k, 1, N_ - k) = temp_splitting_coeffs_left.block(N_ - 1 - k, 0, 1, N_ - k);
-    return coeffs;
+    // Cardano's method on depressed cubic x^3 + p x + q, where t = x - a / 3
+    const Scalar a = coeffs[2] / coeffs[3], b = coeffs[1] / coeffs[3], c = coeffs[0] / coeffs[3];
+    const Scalar p = b - a * a / 3, q = 2 * a * a * a / 27 - a * b / 3 + c;
+    const Scalar discriminant = q * q / 4 + p * p * p / 27;
+    if (discriminant > 0)
+    {
+      const Scalar sqrt_discriminant = std::sqrt(discriminant);
+      roots[count++] = std::cbrt(-q / 2 + sqrt_discriminant) + std::cbrt(-q / 2 - sqrt_discriminant) - a / 3;
+    }
+    else if (p == 0)
+      roots[count++] = -a / 3;
+    else
+    {
+      const Scalar r = 2 * std::sqrt(-p / 3);
+      const Scalar phi = std::acos(std::max(Scalar(-1), std::min(Scalar(1), 3 * q / (p * r)))) / 3;
+      for (uint k = 0; k < 3; k++)
+        roots[count++] = r * std::cos(phi - 2 * Scalar(M_PI) * k / 3) - a / 3;
+    }
+
+    // polish with Newton's method
+    for (uint k = 0; k < count; k++)
+      for (uint iter = 0; iter < 2; iter++)
+      {
+        const Scalar t = roots[k];
+        const Scalar f = ((coeffs[3] * t + coeffs[2]) * t + coeffs[1]) * t + coeffs[0];
+        const Scalar f_d = (3 * coeffs[3] * t + 2 * coeffs[2]) * t + coeffs[1];
+        if (f_d != 0)
+          roots[k] -= f / f_d;
+      }
   }
+  return count;
 }
 
-Curve::Coeffs Curve::elevateOrderCoeffs(uint n) const
+/*!
+ * \brief Get convex hull of points with Andrew's monotone chain algorithm
+ * \param points Nx2 matrix where each row is a point
+ * \return A vector of hull vertices in counterclockwise order
+ */
+template <typename Scalar> PointVectorT<Scalar> convexHull(const Eigen::Matrix<Scalar, Eigen::Dynamic, 2>& points)
 {
-  if (elevate_order_coeffs_.find(n) == elevate_order_coeffs_.end())
+  using Point = PointT<Scalar>;
+  PointVectorT<Scalar> sorted;
+  sorted.reserve(static_cast<std::size_t>(points.rows()));
+  for (Eigen::Index k = 0; k < points.rows(); k++)
+    sorted.push_back(points.row(k));
+  std::sort(sorted.begin(), sorted.end(),
+            [](const Point& a, const Point& b) { return a.x() < b.x() || (a.x() == b.x() && a.y() < b.y()); });
+  sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+  if (sorted.size() < 3)
+    return sorted;
+
+  auto cross = [](const Point& o, const Point& a, const Point& b) {
+    return (a.x() - o.x()) * (b.y() - o.y()) - (a.y() - o.y()) * (b.x() - o.x());
+  };
+
+  // lower hull left to right, then upper hull right to left
+  PointVectorT<Scalar> hull(2 * sorted.size());
+  std::size_t size = 0;
+  for (std::size_t k = 0; k < sorted.size(); k++)
   {
-    elevate_order_coeffs_.insert(std::make_pair(n, Coeffs::Zero(n + 1, n)));
-    elevate_order_coeffs_.at(n).diagonal() = 1 - Eigen::ArrayXd::LinSpaced(n, 0, n - 1) / n;
-    elevate_order_coeffs_.at(n).diagonal(-1) = Eigen::ArrayXd::LinSpaced(n, 1, n) / n;
+    while (size >= 2 && cross(hull[size - 2], hull[size - 1], sorted[k]) <= 0)
+      size--;
+    hull[size++] = sorted[k];
   }
-  return elevate_order_coeffs_.at(n);
+  for (std::size_t k = sorted.size() - 1, lower_size = size + 1; k-- > 0;)
+  {
+    while (size >= lower_size && cross(hull[size - 2], hull[size - 1], sorted[k]) <= 0)
+      size--;
+    hull[size++] = sorted[k];
+  }
+  hull.resize(size - 1);
+  return hull;
 }
 
-Curve::Coeffs Curve::lowerOrderCoeffs(uint n) const
+/*!
+ * \brief Check if there is an axis separating two convex polygons
+ * \param polygon_a Vertices of first polygon, in order
+ * \param polygon_b Vertices of second polygon, in order
+ * \return True if polygons are separated by a normal of any of their edges
+ */
+template <typename Scalar>
+bool separated(const PointVectorT<Scalar>& polygon_a, const PointVectorT<Scalar>& polygon_b)
 {
-  if (lower_order_coeffs_.find(n) == lower_order_coeffs_.end())
+  auto separated_along = [&polygon_a, &polygon_b](const VectorT<Scalar>& axis) {
+    Scalar min_a = std::numeric_limits<Scalar>::max(), max_a = std::numeric_limits<Scalar>::lowest();
+    Scalar min_b = min_a, max_b = max_a;
+    for (const auto& point : polygon_a)
+    {
+      min_a = std::min(min_a, point.dot(axis));
+      max_a = std::max(max_a, point.dot(axis));
+    }
+    for (const auto& point : polygon_b)
+    {
+      min_b = std::min(min_b, point.dot(axis));
+      max_b = std::max(max_b, point.dot(axis));
+    }
+    return max_a < min_b || max_b < min_a;
+  };
+
+  for (const auto* polygon : {&polygon_a, &polygon_b})
+    for (std::size_t k = 0; polygon->size() > 1 && k < polygon->size(); k++)
+    {
+      const VectorT<Scalar> edge = (*polygon)[(k + 1) % polygon->size()] - (*polygon)[k];
+      if (separated_along(VectorT<Scalar>(-edge.y(), edge.x())))
+        return true;
+      // segment has no other edges, so its direction is checked as well
+      if (polygon->size() == 2 && separated_along(edge))
+        return true;
+    }
+  return false;
+}
+
+/*!
+ * \brief Multiply two polynomials in Bernstein form
+ * \param a Bernstein coefficients of first polynomial
+ * \param b Bernstein coefficients of second polynomial
+ * \return Bernstein coefficients of product, with degree equal to sum of degrees
+ */
+template <typename Scalar>
+std::vector<Scalar> bernsteinProduct(const std::vector<Scalar>& a, const std::vector<Scalar>& b)
+{
+  const std::size_t p = a.size() - 1, q = b.size() - 1;
+  auto binomials = [](std::size_t n) {
+    std::vector<Scalar> row(n + 1, 1);
+    for (std::size_t k = 1; k < n; k++)
+      row[k] = row[k - 1] * (n - k + 1) / k;
+    return row;
+  };
+  const std::vector<Scalar> binomial_p = binomials(p), binomial_q = binomials(q), binomial_pq = binomials(p + q);
+
+  std::vector<Scalar> product(p + q + 1, 0);
+  for (std::size_t i = 0; i <= p; i++)
+    for (std::size_t j = 0; j <= q; j++)
+      product[i + j] += binomial_p[i] * binomial_q[j] * a[i] * b[j];
+  for (std::size_t k = 0; k <= p + q; k++)
+    product[k] /= binomial_pq[k];
+  return product;
+}
+
+/*!
+ * \brief Differentiate polynomial in Bernstein form
+ * \param a Bernstein coefficients of polynomial with degree at least 1
+ * \return Bernstein coefficients of derivative
+ */
+template <typename Scalar> std::vector<Scalar> bernsteinDerivative(const std::vector<Scalar>& a)
+{
+  std::vector<Scalar> derivative(a.size() - 1);
+  for (std::size_t k = 0; k < derivative.size(); k++)
+    derivative[k] = derivative.size() * (a[k + 1] - a[k]);
+  return derivative;
+}
+
+/*!
+ * \brief Evaluate point and derivatives with de Casteljau's algorithm
+ * \param points Control points, overwritten by intermediate points
+ * \param differences Storage for forward differences, same size as points
+ * \param t Curve parameter
+ * \param jet Zero initialized matrix to fill, row i is an ith derivative
+ *
+ * The ith derivative is n!/(n-i)! times the ith forward difference
+ * of i+1 intermediate points remaining after n-i reduction steps.
+ */
+template <typename Buffer, typename Jet>
+void deCasteljauJet(Buffer& points, Buffer& differences, typename Buffer::Scalar t, Jet& jet)
+{
+  using Scalar = typename Buffer::Scalar;
+  const uint n = static_cast<uint>(points.rows()) - 1;
+  const uint k = std::min(static_cast<uint>(jet.rows()) - 1, n);
+
+  Scalar factor = 1; // n!/(n-k)!
+  for (uint j = 0; j < k; j++)
+    factor *= n - j;
+
+  for (uint m = n + 1; m > 0; m--)
   {
-    lower_order_coeffs_.insert(std::make_pair(n, Coeffs::Zero(n - 1, n)));
-    lower_order_coeffs_.at(n).noalias() =
-        (elevateOrderCoeffs(n - 1).transpose() * elevateOrderCoeffs(n - 1)).inverse() *
-        elevateOrderCoeffs(n - 1).transpose();
+    const uint j = m - 1;
+    if (j <= k)
+    {
+      differences.topRows(m) = points.topRows(m);
+      for (uint l = 0; l < j; l++)
+        for (uint i = 0; i < j - l; i++)
+          differences.row(i) = differences.row(i + 1) - differences.row(i);
+      jet.row(j) = factor * differences.row(0);
+      factor /= n - j + 1;
+    }
+    for (uint i = 0; i + 1 < m; i++)
+      points.row(i) = (1 - t) * points.row(i) + t * points.row(i + 1);
   }
-  return lower_order_coeffs_.at(n);
 }
 
-Curve::Curve(const Eigen::MatrixX2d& points)
+template <typename Scalar> typename CurveT<Scalar>::template CoeffsTable<64> CurveT<Scalar>::bernstein_coeffs_;
+template <typename Scalar> typename CurveT<Scalar>::template CoeffsTable<64> CurveT<Scalar>::splitting_coeffs_left_;
+template <typename Scalar> typename CurveT<Scalar>::template CoeffsTable<64> CurveT<Scalar>::splitting_coeffs_right_;
+template <typename Scalar> typename CurveT<Scalar>::template CoeffsTable<64> CurveT<Scalar>::elevate_order_coeffs_;
+template <typename Scalar> typename CurveT<Scalar>::template CoeffsTable<64> CurveT<Scalar>::lower_order_coeffs_;
+template <typename Scalar> constexpr uint CurveT<Scalar>::quadrature_rules_;
+template <typename Scalar> constexpr uint CurveT<Scalar>::quadrature_sizes_;
+template <typename Scalar>
+std::array<typename CurveT<Scalar>::template LazyCache<typename CurveT<Scalar>::QuadratureRow>,
+           CurveT<Scalar>::quadrature_sizes_>
+    CurveT<Scalar>::quadrature_basis_;
+template <typename Scalar> typename CurveT<Scalar>::template CoeffsTable<0> CurveT<Scalar>::quadrature_basis_overflow_;
+
+template <typename Scalar>
+template <std::size_t Size>
+template <typename Generator>
+const typename CurveT<Scalar>::Coeffs& CurveT<Scalar>::CoeffsTable<Size>::get(uint n, Generator generate)
+{
+  if (n < slots_.size())
+    return slots_[n].get(generate);
+
+  std::lock_guard<std::mutex> lock(overflow_mutex_);
+  n -= static_cast<uint>(slots_.size());
+  if (n >= overflow_.size())
+    overflow_.resize(n + 1);
+  if (!overflow_[n])
+    overflow_[n].reset(new Coeffs(generate()));
+  return *overflow_[n];
+}
+
+template <typename Scalar> void CurveT<Scalar>::resetCache()
+{
+  markModified();
+  cached_power_coeffs_.reset();
+  cached_derivative_.reset();
+  cached_bounding_box_tight_.reset();
+  cached_bounding_box_relaxed_.reset();
+  cached_arc_length_table_.reset();
+  cached_oriented_bounding_box_.reset();
+  cached_convex_hull_.reset();
+  std::atomic_store(&cached_roots_, std::shared_ptr<const RootsCache>());
+  std::atomic_store(&cached_inflections_, std::shared_ptr<const ParametersCache>());
+  std::atomic_store(&cached_curvature_extrema_, std::shared_ptr<const ParametersCache>());
+  std::atomic_store(&cached_polyline_, std::shared_ptr<const PolylineCache>());
+}
+
+template <typename Scalar> void CurveT<Scalar>::markModified()
+{
+  version_++;
+  std::lock_guard<std::mutex> lock(owners_mutex_);
+  for (const auto& owner : owners_)
+    if (auto modifications = owner.lock())
+      modifications->fetch_add(1, std::memory_order_release);
+}
+
+template <typename Scalar>
+void CurveT<Scalar>::addOwner(const std::shared_ptr<std::atomic<std::size_t>>& modifications)
+{
+  std::lock_guard<std::mutex> lock(owners_mutex_);
+  // drop counters of destroyed polycurves
+  owners_.erase(std::remove_if(owners_.begin(), owners_.end(),
+                               [](const std::weak_ptr<std::atomic<std::size_t>>& owner) { return owner.expired(); }),
+                owners_.end());
+  for (const auto& owner : owners_)
+    if (owner.lock() == modifications)
+      return;
+  owners_.push_back(modifications);
+}
+
+template <typename Scalar> const typename CurveT<Scalar>::Coeffs& CurveT<Scalar>::bernsteinCoeffs() const
+{
+  const uint N = N_;
+  return bernstein_coeffs_.get(N, [N] {
+    // coeffs(k, i) = (-1)^(k-i) * binomial(N-1, k) * binomial(k, i), built with exact integer recurrences
+    Coeffs coeffs(Coeffs::Zero(N, N));
+    Scalar binomial_n_k = 1;
+    for (uint k = 0; k < N; k++)
+    {
+      if (k > 0)
+        binomial_n_k = binomial_n_k * (N - k) / k;
+      coeffs(k, k) = binomial_n_k;
+      for (uint i = k; i > 0; i--)
+        coeffs(k, i - 1) = -coeffs(k, i) * i / (k - i + 1);
+    }
+    return coeffs;
+  });
+}
+
+template <typename Scalar> const typename CurveT<Scalar>::MatrixX2& CurveT<Scalar>::powerCoeffs() const
+{
+  return cached_power_coeffs_.get([this] { return MatrixX2(bernsteinCoeffs() * control_points_); });
+}
+
+template <typename Scalar> const typename CurveT<Scalar>::ArcLengthTable& CurveT<Scalar>::arcLengthTable() const
+{
+  return cached_arc_length_table_.get([this] {
+    const uint M = arc_length_intervals_;
+    ArcLengthTable table;
+    table.t = VectorX::LinSpaced(M + 1, 0, 1);
+    table.speed = derivativeAt(table.t).rowwise().norm();
+    table.s.resize(M + 1);
+    table.s(0) = 0;
+    for (uint k = 0; k < M; k++)
+      table.s(k + 1) = table.s(k) + legendreGaussLength(table.t(k), table.t(k + 1));
+
+    // dt/ds limited to 3 times the secant slope of adjacent intervals (Fritsch-Carlson)
+    table.slope.resize(M + 1);
+    for (uint k = 0; k <= M; k++)
+    {
+      Scalar slope = table.speed(k) > 0 ? 1 / table.speed(k) : std::numeric_limits<Scalar>::max();
+      if (k > 0 && table.s(k) > table.s(k - 1))
+        slope = std::min(slope, 3 * (table.t(k) - table.t(k - 1)) / (table.s(k) - table.s(k - 1)));
+      if (k < M && table.s(k + 1) > table.s(k))
+        slope = std::min(slope, 3 * (table.t(k + 1) - table.t(k)) / (table.s(k + 1) - table.s(k)));
+      table.slope(k) = slope == std::numeric_limits<Scalar>::max() ? 0 : slope;
+    }
+    return table;
+  });
+}
+
+template <typename Scalar> Scalar CurveT<Scalar>::ArcLengthTable::length(Scalar t_query) const
+{
+  const Eigen::Index M = t.size() - 1;
+  const Eigen::Index k = std::min(static_cast<Eigen::Index>(t_query * M), M - 1);
+
+  // cubic Hermite interpolation
+  const Scalar h = t(k + 1) - t(k), u = (t_query - t(k)) / h;
+  return (2 * u * u * u - 3 * u * u + 1) * s(k) + (u * u * u - 2 * u * u + u) * h * speed(k) +
+         (-2 * u * u * u + 3 * u * u) * s(k + 1) + (u * u * u - u * u) * h * speed(k + 1);
+}
+
+template <typename Scalar> Scalar CurveT<Scalar>::ArcLengthTable::parameter(Scalar s_query) const
+{
+  const Eigen::Index M = t.size() - 1;
+  Eigen::Index k = std::upper_bound(s.data(), s.data() + M + 1, s_query) - s.data() - 1;
+  k = std::max(Eigen::Index(0), std::min(k, M - 1));
+  if (s(k + 1) == s(k))
+    return t(k);
+
+  // monotone cubic Hermite interpolation
+  const Scalar h = s(k + 1) - s(k), u = (s_query - s(k)) / h;
+  return (2 * u * u * u - 3 * u * u + 1) * t(k) + (u * u * u - 2 * u * u + u) * h * slope(k) +
+         (-2 * u * u * u + 3 * u * u) * t(k + 1) + (u * u * u - u * u) * h * slope(k + 1);
+}
+
+template <typename Scalar> const typename CurveT<Scalar>::Coeffs& CurveT<Scalar>::splittingCoeffsLeft() const
+{
+  return splitting_coeffs_left_.get(N_, [this] { return splittingCoeffsLeft(0.5); });
+}
+
+template <typename Scalar> const typename CurveT<Scalar>::Coeffs& CurveT<Scalar>::splittingCoeffsRight() const
+{
+  return splitting_coeffs_right_.get(N_, [this] { return splittingCoeffsRight(0.5); });
+}
+
+template <typename Scalar> typename CurveT<Scalar>::Coeffs CurveT<Scalar>::splittingCoeffsLeft(Scalar z) const
+{
+  // de Casteljau's algorithm applied to each unit vector
+  Coeffs coeffs(Coeffs::Identity(N_, N_));
+  deCasteljauLeft(coeffs, z);
+  return coeffs;
+}
+
+template <typename Scalar> typename CurveT<Scalar>::Coeffs CurveT<Scalar>::splittingCoeffsRight(Scalar z) const
+{
+  Coeffs coeffs(Coeffs::Identity(N_, N_));
+  deCasteljauRight(coeffs, z);
+  return coeffs;
+}
+
+template <typename Scalar> const typename CurveT<Scalar>::Coeffs& CurveT<Scalar>::elevateOrderCoeffs(uint n) const
+{
+  return elevate_order_coeffs_.get(n, [n] {
+    Coeffs coeffs(Coeffs::Zero(n + 1, n));
+    coeffs.diagonal() = 1 - ArrayX::LinSpaced(n, 0, n - 1) / n;
+    coeffs.diagonal(-1) = ArrayX::LinSpaced(n, 1, n) / n;
+    return coeffs;
+  });
+}
+
+template <typename Scalar> const typename CurveT<Scalar>::Coeffs& CurveT<Scalar>::lowerOrderCoeffs(uint n) const
+{
+  return lower_order_coeffs_.get(n, [this, n] {
+    const Coeffs& elevate_coeffs = elevateOrderCoeffs(n - 1);
+    return Coeffs((elevate_coeffs.transpose() * elevate_coeffs).inverse() * elevate_coeffs.transpose());
+  });
+}
+
+template <typename Scalar>
+const typename CurveT<Scalar>::Coeffs& CurveT<Scalar>::quadratureBasis(uint n, uint nodes) const
+{
+  static_assert(quadrature_rules_ == LegendreGauss::max_N, "Each Legendre-Gauss rule needs a slot for every size");
+  auto generate = [n, nodes] {
+    const LegendreGauss::Rule& rule = LegendreGauss::rule(nodes);
+    Coeffs basis(Coeffs::Zero(nodes, n));
+    for (uint k = 0; k < nodes; k++)
+    {
+      // Bernstein polynomials raised one degree at a time
+      const Scalar t = (rule.abcissae[k] + 1) / 2;
+      basis(k, 0) = 1;
+      for (uint j = 1; j < n; j++)
+      {
+        for (uint i = j; i > 0; i--)
+          basis(k, i) = (1 - t) * basis(k, i) + t * basis(k, i - 1);
+        basis(k, 0) *= 1 - t;
+      }
+    }
+    return basis;
+  };
+
+  if (n <= quadrature_sizes_)
+  {
+    const QuadratureRow& row = quadrature_basis_[n - 1].get([] { return QuadratureRow(quadrature_rules_); });
+    return row[nodes - 1].get(generate);
+  }
+  return quadrature_basis_overflow_.get((n - quadrature_sizes_ - 1) * quadrature_rules_ + nodes - 1, generate);
+}
+
+template <typename Scalar> CurveT<Scalar>::CurveT(const MatrixX2& points)
 {
   N_ = static_cast<uint>(points.rows());
   control_points_ = points;
+  evaluator_ = Evaluator::BEZIER_DEFAULT_EVALUATOR;
+  quadrature_nodes_ = defaultQuadratureNodes();
+  arc_length_intervals_ = 0;
+  version_ = 0;
 }
 
-Curve::Curve(const PointVector& points)
+template <typename Scalar> CurveT<Scalar>::CurveT(const PointVector& points)
 {
   N_ = static_cast<uint>(points.size());
   control_points_.resize(N_, 2);
   for (uint k = 0; k < N_; k++)
     control_points_.row(k) = points[k];
+  evaluator_ = Evaluator::BEZIER_DEFAULT_EVALUATOR;
+  quadrature_nodes_ = defaultQuadratureNodes();
+  arc_length_intervals_ = 0;
+  version_ = 0;
 }
 
-Curve::Curve(const Curve& curve) : Curve(curve.controlPoints()) {}
+template <typename Scalar> CurveT<Scalar>::CurveT(const CurveT& curve) : CurveT(curve.controlPoints())
+{
+  evaluator_ = curve.evaluator_;
+  quadrature_nodes_ = curve.quadrature_nodes_;
+  arc_length_intervals_ = curve.arc_length_intervals_;
+}
+
+template <typename Scalar> uint CurveT<Scalar>::order() { return N_ - 1; }
+
+template <typename Scalar> void CurveT<Scalar>::setEvaluator(Evaluator evaluator)
+{
+  evaluator_ = evaluator;
+  cached_derivative_.reset();
+}
 
-uint Curve::order() { return N_ - 1; }
+template <typename Scalar> Evaluator CurveT<Scalar>::evaluator() const { return evaluator_; }
 
-PointVector Curve::controlPoints() const
+template <typename Scalar> PointVectorT<Scalar> CurveT<Scalar>::controlPoints() const
 {
   PointVector points(N_);
   for (uint k = 0; k < N_; k++)
@@ -132,17 +571,19 @@ PointVector Curve::controlPoints() const
   return points;
 }
 
-std::pair<Point, Point> Curve::endPoints() const
+template <typename Scalar> std::pair<PointT<Scalar>, PointT<Scalar>> CurveT<Scalar>::endPoints() const
 {
   return std::make_pair(control_points_.row(0), control_points_.row(N_ - 1));
 }
 
-PointVector Curve::polyline(double smoothness, double precision) const
+template <typename Scalar> PointVectorT<Scalar> CurveT<Scalar>::polyline(Scalar smoothness, Scalar precision) const
 {
-  if (!cached_polyline_ || cached_polyline_params_ != std::make_tuple(smoothness, precision))
+  auto cached_polyline = std::atomic_load(&cached_polyline_);
+  if (!cached_polyline || cached_polyline->first != std::make_tuple(smoothness, precision))
   {
-    auto* polyline = new PointVector;
-    std::vector<Eigen::MatrixX2d> subcurves;
+    auto new_cache = std::make_shared<PolylineCache>(std::make_tuple(smoothness, precision), PointVector());
+    auto* polyline = &new_cache->second;
+    std::vector<MatrixX2> subcurves;
     subcurves.push_back(control_points_);
     polyline->push_back(control_points_.row(0));
     while (!subcurves.empty())
@@ -150,8 +591,8 @@ PointVector Curve::polyline(double smoothness, double precision) const
       auto cp = subcurves.back();
       subcurves.pop_back();
 
-      double string_length = (cp.row(0) - cp.row(N_ - 1)).norm();
-      double hull_length = 0.0;
+      Scalar string_length = (cp.row(0) - cp.row(N_ - 1)).norm();
+      Scalar hull_length = 0.0;
       for (uint k = 1; k < N_; k++)
         hull_length += (cp.row(k) - cp.row(k - 1)).norm();
 
@@ -161,47 +602,244 @@ PointVector Curve::polyline(double smoothness, double precision) const
       }
       else
       {
-        subcurves.emplace_back(splittingCoeffsRight(0.5) * cp);
-        subcurves.emplace_back(splittingCoeffsLeft(0.5) * cp);
+        subcurves.emplace_back(splittingCoeffsRight() * cp);
+        subcurves.emplace_back(splittingCoeffsLeft() * cp);
       }
     }
 
-    (const_cast<Curve*>(this))->cached_polyline_params_ = std::make_tuple(smoothness, precision);
-    (const_cast<Curve*>(this))->cached_polyline_.reset(polyline);
+    cached_polyline = new_cache;
+    std::atomic_store(&cached_polyline_, cached_polyline);
   }
-  return *cached_polyline_;
+  return cached_polyline->second;
 }
 
-double Curve::length() const { return length(0.0, 1.0); }
+template <typename Scalar> void CurveT<Scalar>::setQuadratureNodes(uint n)
+{
+  LegendreGauss::rule(n); // throws if there is no quadrature with n nodes
+  quadrature_nodes_ = n;
+  cached_arc_length_table_.reset();
+  markModified();
+}
+
+template <typename Scalar> uint CurveT<Scalar>::quadratureNodes() const { return quadrature_nodes_; }
 
-double Curve::length(double t) const { return length(0.0, t); }
+template <typename Scalar> uint CurveT<Scalar>::defaultQuadratureNodes() { return LegendreGauss::N; }
+
+template <typename Scalar> void CurveT<Scalar>::enableArcLengthTable(uint intervals)
+{
+  if (intervals == 0)
+    throw std::invalid_argument{"Arc length table needs at least one interval."};
+  arc_length_intervals_ = intervals;
+  cached_arc_length_table_.reset();
+  markModified();
+}
 
-double Curve::length(double t1, double t2) const
+template <typename Scalar> void CurveT<Scalar>::disableArcLengthTable()
 {
-  double sum = 0;
+  arc_length_intervals_ = 0;
+  cached_arc_length_table_.reset();
+  markModified();
+}
+
+template <typename Scalar> Scalar CurveT<Scalar>::length() const { return length(0.0, 1.0); }
 
-  for (uint k = 0; k < LegendreGauss::N; k++)
-    sum += LegendreGauss::weights[k] * derivativeAt(LegendreGauss::abcissae[k] * (t2 - t1) / 2 + (t1 + t2) / 2).norm();
+template <typename Scalar> Scalar CurveT<Scalar>::length(Scalar t) const { return length(0.0, t); }
 
-  return sum * (t2 - t1) / 2;
+template <typename Scalar> Scalar CurveT<Scalar>::length(Scalar t1, Scalar t2) const
+{
+  Scalar exact_length;
+  if (closedFormLength(t1, t2, exact_length))
+    return exact_length;
+  if (arc_length_intervals_ > 0 && t1 >= 0 && t1 <= 1 && t2 >= 0 && t2 <= 1)
+  {
+    const ArcLengthTable& table = arcLengthTable();
+    return table.length(t2) - table.length(t1);
+  }
+  return legendreGaussLength(t1, t2);
+}
+
+template <typename Scalar> Scalar CurveT<Scalar>::legendreGaussLength(Scalar t1, Scalar t2) const
+{
+  if (t1 > t2)
+    return -legendreGaussLength(t2, t1);
+
+  const LegendreGauss::Rule& rule = LegendreGauss::rule(quadrature_nodes_);
+  const MatrixX2& hodograph = derivative()->control_points_;
+  const Coeffs& basis = quadratureBasis(static_cast<uint>(hodograph.rows()), rule.n);
+  const Eigen::Map<const Eigen::VectorXd> weights(rule.weights, rule.n);
+
+  // hodograph is restricted to [t1, t2], so derivatives at all nodes are one product with the cached basis
+  Eigen::Matrix<Scalar, Eigen::Dynamic, 2, Eigen::ColMajor, LegendreGauss::max_N, 2> derivatives;
+  if (hodograph.rows() <= DeCasteljauBuffer<Scalar>::MaxRowsAtCompileTime)
+  {
+    DeCasteljauBuffer<Scalar> points(hodograph);
+    deCasteljauInterval(points, t1, t2);
+    derivatives.noalias() = basis * points;
+  }
+  else
+  {
+    MatrixX2 points(hodograph);
+    deCasteljauInterval(points, t1, t2);
+    derivatives.noalias() = basis * points;
+  }
+
+  return weights.cast<Scalar>().dot(derivatives.rowwise().norm()) * (t2 - t1) / 2;
+}
+
+template <typename Scalar> bool CurveT<Scalar>::closedFormLength(Scalar t1, Scalar t2, Scalar& length) const
+{
+  if (N_ < 2)
+  {
+    length = 0;
+    return true;
+  }
+  if (N_ == 2)
+  {
+    length = (control_points_.row(1) - control_points_.row(0)).norm() * (t2 - t1);
+    return true;
+  }
+  if (N_ > 3)
+    return false;
+
+  // quadratic: speed is |A t + B|, integrated as sqrt(a) * sqrt(u^2 + k^2) over u = t + (A.B) / a
+  const Vector A = 2 * (control_points_.row(2) - 2 * control_points_.row(1) + control_points_.row(0));
+  const Vector B = 2 * (control_points_.row(1) - control_points_.row(0));
+  const Scalar a = A.squaredNorm();
+  // nearly constant speed is left to quadrature, as u gets large and the closed form loses precision
+  if (a <= Scalar(1e-6) * B.squaredNorm())
+    return false;
+
+  const Scalar k = std::fabs(A.x() * B.y() - A.y() * B.x()) / a;
+  auto primitive = [k](Scalar u) {
+    return k > 0 ? u * std::sqrt(u * u + k * k) + k * k * std::asinh(u / k) : u * std::fabs(u);
+  };
+  const Scalar u0 = A.dot(B) / a;
+  length = std::sqrt(a) / 2 * (primitive(t2 + u0) - primitive(t1 + u0));
+  return true;
 }
 
-double Curve::iterateByLength(double t, double s, double epsilon, std::size_t max_iter) const
+template <typename Scalar> Scalar CurveT<Scalar>::length(Scalar t1, Scalar t2, Scalar tolerance, Scalar* error) const
 {
-  const double s_t = length(t);
+  if (!(tolerance > 0))
+    throw std::invalid_argument{"Parameter 'tolerance' must be positive."};
+
+  Scalar exact_length;
+  if (closedFormLength(t1, t2, exact_length))
+  {
+    if (error)
+      *error = 0;
+    return exact_length;
+  }
+
+  using LegendreGauss::gauss_weights;
+  using LegendreGauss::kronrod_abcissae;
+  using LegendreGauss::kronrod_weights;
+  const uint max_depth = 30;
+  const uint max_intervals = 2000;
+
+  // Kronrod estimate and its difference to Gauss estimate on [a, b]
+  auto gauss_kronrod = [this](Scalar a, Scalar b) {
+    const Scalar half = (b - a) / 2, center = (a + b) / 2;
+    VectorX nodes(15);
+    for (uint k = 0; k < 8; k++)
+    {
+      nodes(k) = center - half * kronrod_abcissae[k];
+      nodes(14 - k) = center + half * kronrod_abcissae[k];
+    }
+    VectorX speed = derivativeAt(nodes).rowwise().norm();
+
+    Scalar kronrod = kronrod_weights[7] * speed(7);
+    Scalar gauss = gauss_weights[3] * speed(7);
+    for (uint k = 0; k < 7; k++)
+    {
+      kronrod += kronrod_weights[k] * (speed(k) + speed(14 - k));
+      if (k % 2 == 1)
+        gauss += gauss_weights[k / 2] * (speed(k) + speed(14 - k));
+    }
+    return std::make_pair(kronrod * half, std::abs((kronrod - gauss) * half));
+  };
+
+  // intervals are kept in a heap, so the one with the largest error is refined first
+  using Interval = std::tuple<Scalar, Scalar, Scalar, Scalar, Scalar, uint>; // error, length, a, b, tolerance, depth
+  std::vector<Interval> intervals;
+  auto push_interval = [&](Scalar a, Scalar b, Scalar interval_tolerance, uint depth) {
+    auto estimate = gauss_kronrod(a, b);
+    intervals.emplace_back(estimate.second, estimate.first, a, b, interval_tolerance, depth);
+    std::push_heap(intervals.begin(), intervals.end());
+  };
+
+  Scalar sum = 0, total_error = 0;
+  uint evaluated = 1;
+  push_interval(t1, t2, tolerance, 0);
+  while (!intervals.empty())
+  {
+    std::pop_heap(intervals.begin(), intervals.end());
+    Scalar interval_error, interval_length, a, b, interval_tolerance;
+    uint depth;
+    std::tie(interval_error, interval_length, a, b, interval_tolerance, depth) = intervals.back();
+    intervals.pop_back();
+
+    // when out of budget, remaining intervals are accepted with their current estimates
+    if (interval_error <= interval_tolerance || depth == max_depth || evaluated + 2 > max_intervals)
+    {
+      sum += interval_length;
+      total_error += interval_error;
+    }
+    else
+    {
+      push_interval(a, (a + b) / 2, interval_tolerance / 2, depth + 1);
+      push_interval((a + b) / 2, b, interval_tolerance / 2, depth + 1);
+      evaluated += 2;
+    }
+  }
+
+  if (error)
+    *error = total_error;
+  return sum;
+}
+
+template <typename Scalar>
+Scalar CurveT<Scalar>::iterateByLength(Scalar t, Scalar s, Scalar epsilon, std::size_t max_iter) const
+{
+  if (N_ == 2)
+  {
+    // linear: arc length is proportional to t
+    const Scalar chord = (control_points_.row(1) - control_points_.row(0)).norm();
+    return chord > 0 ? std::max(Scalar(0), std::min(Scalar(1), t + s / chord)) : t;
+  }
+
+  const Scalar s_t = length(t);
 
   if (s_t + s < 0)
     return 0;
   if (s_t + s > length())
     return 1;
 
+  if (arc_length_intervals_ > 0 && N_ > 3)
+  {
+    // initial guess from the table, refined with Newton on interpolated length
+    const ArcLengthTable& table = arcLengthTable();
+    t = table.parameter(s_t + s);
+    for (std::size_t current_iter = 0; current_iter < max_iter; current_iter++)
+    {
+      Scalar f = table.length(t) - s_t - s;
+      Scalar f_d = derivativeAt(t).norm();
+      if (std::fabs(f) < epsilon || f_d == 0)
+        break;
+      t = std::max(Scalar(0), std::min(Scalar(1), t - f / f_d));
+    }
+    return t;
+  }
+
   std::size_t current_iter = 0;
   while (current_iter < max_iter)
   {
     // Halley
-    double f = (length(t) - s_t - s);
-    double f_d = derivativeAt(t).norm();
-    double f_d2 = derivativeAt(2, t).norm();
+    Eigen::Matrix<Scalar, 3, 2> jet;
+    jetAt(t, jet);
+    Scalar f = (length(t) - s_t - s);
+    Scalar f_d = jet.row(1).norm();
+    Scalar f_d2 = jet.row(2).norm();
 
     t -= (2 * f * f_d) / (2 * f_d * f_d - f * f_d2);
 
@@ -215,26 +853,93 @@ double Curve::iterateByLength(double t, double s, double epsilon, std::size_t ma
   return t;
 }
 
-void Curve::reverse()
+template <typename Scalar>
+std::pair<typename CurveT<Scalar>::VectorX, typename CurveT<Scalar>::MatrixX2>
+CurveT<Scalar>::resampleByLength(Scalar spacing, Scalar epsilon) const
+{
+  if (spacing <= 0)
+    throw std::invalid_argument{"Parameter 'spacing' must be positive."};
+
+  std::pair<VectorX, MatrixX2> samples;
+  const uint count = sampleCount(length(), spacing);
+  samples.first.resize(count);
+  samples.second.resize(count, 2);
+  const uint written = std::min(count, resampleByLength(spacing, samples.first, samples.second, 0, epsilon));
+  samples.first.conservativeResize(written);
+  samples.second.conservativeResize(written, 2);
+  return samples;
+}
+
+template <typename Scalar> uint CurveT<Scalar>::sampleCount(Scalar length, Scalar spacing, Scalar offset)
+{
+  if (offset > length)
+    return 0;
+  // sample at the end is kept even if rounding leaves it slightly beyond
+  const Scalar tolerance = std::sqrt(std::numeric_limits<Scalar>::epsilon());
+  return static_cast<uint>(std::floor((length - offset) / spacing + tolerance)) + 1;
+}
+
+template <typename Scalar>
+uint CurveT<Scalar>::resampleByLength(Scalar spacing, Eigen::Ref<VectorX> t_vector, Eigen::Ref<MatrixX2> points,
+                                      Scalar offset, Scalar epsilon) const
+{
+  if (spacing <= 0)
+    throw std::invalid_argument{"Parameter 'spacing' must be positive."};
+
+  const uint count = sampleCount(length(), spacing, offset);
+  const uint written = std::min(count, static_cast<uint>(std::min(t_vector.size(), points.rows())));
+  const std::size_t max_iter = 30;
+
+  // march from the previous sample, measuring only the length in between
+  Scalar t_prev = 0, s_prev = 0;
+  for (uint k = 0; k < written; k++)
+  {
+    const Scalar ds = offset + k * spacing - s_prev;
+    Scalar lower = t_prev, upper = 1, t = t_prev;
+    Scalar speed = derivativeAt(t_prev).norm();
+    if (speed > 0)
+      t = std::min(upper, t_prev + ds / speed);
+
+    Scalar f = length(t_prev, t) - ds;
+    for (std::size_t iter = 0; iter < max_iter && std::fabs(f) >= epsilon; iter++)
+    {
+      (f > 0 ? upper : lower) = t;
+
+      // Newton, safeguarded with bisection
+      speed = derivativeAt(t).norm();
+      Scalar t_next = speed > 0 ? t - f / speed : lower;
+      t = t_next > lower && t_next < upper ? t_next : (lower + upper) / 2;
+      f = length(t_prev, t) - ds;
+    }
+
+    s_prev += ds + f;
+    t_prev = t;
+    t_vector(k) = t;
+    points.row(k) = valueAt(t);
+  }
+  return count;
+}
+
+template <typename Scalar> void CurveT<Scalar>::reverse()
 {
   control_points_ = control_points_.colwise().reverse().eval();
   resetCache();
 }
 
-void Curve::manipulateControlPoint(uint idx, const Point& point)
+template <typename Scalar> void CurveT<Scalar>::manipulateControlPoint(uint idx, const Point& point)
 {
   control_points_.row(idx) = point;
   resetCache();
 }
 
-void Curve::manipulateCurvature(double t, const Point& point)
+template <typename Scalar> void CurveT<Scalar>::manipulateCurvature(Scalar t, const Point& point)
 {
   if (N_ < 3 || N_ > 4)
     throw std::logic_error{"Only quadratic and cubic curves can be manipulated"};
 
-  double r =
+  Scalar r =
       std::fabs((std::pow(t, N_ - 1) + std::pow(1 - t, N_ - 1) - 1) / (std::pow(t, N_ - 1) + std::pow(1 - t, N_ - 1)));
-  double u = std::pow(1 - t, N_ - 1) / (std::pow(t, N_ - 1) + std::pow(1 - t, N_ - 1));
+  Scalar u = std::pow(1 - t, N_ - 1) / (std::pow(t, N_ - 1) + std::pow(1 - t, N_ - 1));
   Point C = u * control_points_.row(0) + (1 - u) * control_points_.row(N_ - 1);
   const Point& B = point;
   Point A = B - (C - B) / r;
@@ -259,241 +964,635 @@ void Curve::manipulateCurvature(double t, const Point& point)
   resetCache();
 }
 
-void Curve::elevateOrder()
+template <typename Scalar> void CurveT<Scalar>::elevateOrder()
 {
-  Eigen::MatrixXd new_points = elevateOrderCoeffs(N_) * control_points_;
+  Coeffs new_points = elevateOrderCoeffs(N_) * control_points_;
   control_points_.resize(++N_, 2);
   control_points_ = new_points;
   resetCache();
 }
 
-void Curve::lowerOrder()
+template <typename Scalar> void CurveT<Scalar>::lowerOrder()
 {
   if (N_ == 2)
     throw std::logic_error{"Cannot further reduce the order of curve."};
-  Eigen::MatrixXd new_points = lowerOrderCoeffs(N_) * control_points_;
+  Coeffs new_points = lowerOrderCoeffs(N_) * control_points_;
   control_points_.resize(--N_, 2);
   control_points_ = new_points;
   resetCache();
 }
 
-Point Curve::valueAt(double t) const
+template <typename Scalar> PointT<Scalar> CurveT<Scalar>::valueAt(Scalar t) const
 {
   if (N_ == 0)
     return {0, 0};
-  Eigen::VectorXd power_basis = Eigen::pow(t, Eigen::ArrayXd::LinSpaced(N_, 0, N_ - 1));
-  return (power_basis.transpose() * bernsteinCoeffs() * control_points_).transpose();
+
+  if (evaluator_ == Evaluator::DeCasteljau)
+  {
+    Eigen::Matrix<Scalar, 1, 2> value;
+    jetAt(t, value);
+    return value.transpose();
+  }
+
+  // Horner's method
+  const MatrixX2& coeffs = powerCoeffs();
+  Point value = coeffs.row(N_ - 1);
+  for (uint k = N_ - 1; k > 0; k--)
+    value = value * t + coeffs.row(k - 1).transpose();
+  return value;
+}
+
+template <typename Scalar> typename CurveT<Scalar>::MatrixX2 CurveT<Scalar>::valueAt(const VectorX& t_vector) const
+{
+  if (N_ == 0)
+    return MatrixX2::Zero(t_vector.size(), 2);
+
+  if (evaluator_ == Evaluator::DeCasteljau)
+  {
+    MatrixX2 values(t_vector.size(), 2);
+    for (Eigen::Index k = 0; k < t_vector.size(); k++)
+      values.row(k) = valueAt(t_vector(k));
+    return values;
+  }
+
+  Coeffs power_basis(t_vector.size(), N_);
+  power_basis.col(0).setOnes();
+  for (uint k = 1; k < N_; k++)
+    power_basis.col(k) = power_basis.col(k - 1).cwiseProduct(t_vector);
+  return power_basis * powerCoeffs();
 }
 
-double Curve::curvatureAt(double t) const
+template <typename Scalar> Scalar CurveT<Scalar>::curvatureAt(Scalar t) const
 {
-  Point d1 = derivativeAt(t);
-  Point d2 = derivativeAt(2, t);
+  Eigen::Matrix<Scalar, 3, 2> jet;
+  jetAt(t, jet);
+  Point d1 = jet.row(1);
+  Point d2 = jet.row(2);
 
   return (d1.x() * d2.y() - d1.y() * d2.x()) / std::pow(d1.norm(), 3);
 }
 
-double Curve::curvatureDerivativeAt(double t) const
+template <typename Scalar> Scalar CurveT<Scalar>::curvatureDerivativeAt(Scalar t) const
 {
-  auto d1 = derivativeAt(t);
-  auto d2 = derivativeAt(2, t);
-  auto d3 = derivativeAt(3, t);
+  Eigen::Matrix<Scalar, 4, 2> jet;
+  jetAt(t, jet);
+  Point d1 = jet.row(1);
+  Point d2 = jet.row(2);
+  Point d3 = jet.row(3);
 
   return (d1.x() * d3.y() - d1.y() * d3.x()) / std::pow(d1.norm(), 3) -
          3 * d1.dot(d2) * (d1.x() * d2.y() - d1.y() * d2.x()) / std::pow(d1.norm(), 5);
 }
 
-Vector Curve::tangentAt(double t, bool normalize) const
+template <typename Scalar>
+typename CurveT<Scalar>::Functionals CurveT<Scalar>::functionals(uint intervals) const
 {
-  Point p(derivativeAt(t));
+  Functionals result{0, 0, 0};
+  if (intervals == 0)
+    return result;
+
+  Eigen::Matrix<Scalar, 4, 2> jet;
+  // add weighted integrands at t, and curvature to maximum
+  auto accumulate = [&](Scalar t, Scalar weight) {
+    jetAt(t, jet);
+    Point d1 = jet.row(1), d2 = jet.row(2), d3 = jet.row(3);
+    const Scalar speed = d1.norm();
+    if (speed == 0)
+      return;
+    const Scalar cross = d1.x() * d2.y() - d1.y() * d2.x();
+    const Scalar curvature = cross / std::pow(speed, 3);
+    const Scalar curvature_derivative =
+        (d1.x() * d3.y() - d1.y() * d3.x()) / std::pow(speed, 3) - 3 * d1.dot(d2) * cross / std::pow(speed, 5);
+
+    result.bending_energy += weight * curvature * curvature * speed;
+    result.curvature_variation += weight * std::fabs(curvature_derivative);
+    result.max_curvature = std::max(result.max_curvature, std::fabs(curvature));
+  };
+
+  const LegendreGauss::Rule& rule = LegendreGauss::rule(quadrature_nodes_);
+  const Scalar h = Scalar(1) / intervals;
+  for (uint i = 0; i < intervals; i++)
+    for (uint k = 0; k < rule.n; k++)
+      accumulate((i + (rule.abcissae[k] + 1) / 2) * h, rule.weights[k] * h / 2);
+  accumulate(0, 0);
+  accumulate(1, 0);
+
+  return result;
+}
+
+template <typename Scalar> VectorT<Scalar> CurveT<Scalar>::tangentAt(Scalar t, bool normalize) const
+{
+  Eigen::Matrix<Scalar, 2, 2> jet;
+  jetAt(t, jet);
+  Point p = jet.row(1);
   if (normalize && p.norm() > 0)
     p.normalize();
   return p;
 }
 
-Vector Curve::normalAt(double t, bool normalize) const
+template <typename Scalar>
+typename CurveT<Scalar>::MatrixX2 CurveT<Scalar>::tangentAt(const VectorX& t_vector, bool normalize) const
+{
+  MatrixX2 tangents = derivativeAt(t_vector);
+  if (normalize)
+  {
+    VectorX norms = tangents.rowwise().norm();
+    for (Eigen::Index k = 0; k < tangents.rows(); k++)
+      if (norms(k) > 0)
+        tangents.row(k) /= norms(k);
+  }
+  return tangents;
+}
+
+template <typename Scalar> VectorT<Scalar> CurveT<Scalar>::normalAt(Scalar t, bool normalize) const
 {
   Point tangent = tangentAt(t, normalize);
   return {-tangent.y(), tangent.x()};
 }
 
-std::shared_ptr<const Curve> Curve::derivative() const
+template <typename Scalar>
+typename CurveT<Scalar>::MatrixX2 CurveT<Scalar>::normalAt(const VectorX& t_vector, bool normalize) const
 {
-  if (!cached_derivative_)
-  {
-    (const_cast<Curve*>(this))->cached_derivative_ =
-        N_ == 1 ? std::make_shared<const Curve>(PointVector{Point(0, 0)})
-                : std::make_shared<const Curve>(
-                      ((N_ - 1) * (control_points_.bottomRows(N_ - 1) - control_points_.topRows(N_ - 1))).eval());
-  }
-  return cached_derivative_;
+  MatrixX2 tangents = tangentAt(t_vector, normalize);
+  MatrixX2 normals(tangents.rows(), 2);
+  normals.col(0) = -tangents.col(1);
+  normals.col(1) = tangents.col(0);
+  return normals;
 }
 
-std::shared_ptr<const Curve> Curve::derivative(uint n) const
+template <typename Scalar> std::shared_ptr<const CurveT<Scalar>> CurveT<Scalar>::derivative() const
+{
+  return cached_derivative_.get([this] {
+    auto derivative = N_ == 1 ? std::make_shared<CurveT>(PointVector{Point(0, 0)})
+                              : std::make_shared<CurveT>(
+                                    ((N_ - 1) * (control_points_.bottomRows(N_ - 1) - control_points_.topRows(N_ - 1)))
+                                        .eval());
+    derivative->evaluator_ = evaluator_;
+    return std::shared_ptr<const CurveT>(derivative);
+  });
+}
+
+template <typename Scalar> std::shared_ptr<const CurveT<Scalar>> CurveT<Scalar>::derivative(uint n) const
 {
   if (n == 0)
     throw std::invalid_argument{"Parameter 'n' cannot be zero."};
-  std::shared_ptr<const Curve> nth_derivative = derivative();
+  std::shared_ptr<const CurveT> nth_derivative = derivative();
   for (uint k = 1; k < n; k++)
     nth_derivative = nth_derivative->derivative();
   return nth_derivative;
 }
 
-Point Curve::derivativeAt(double t) const { return derivative()->valueAt(t); }
+template <typename Scalar>
+PointT<Scalar> CurveT<Scalar>::derivativeAt(Scalar t) const { return derivative()->valueAt(t); }
 
-Point Curve::derivativeAt(uint n, double t) const { return derivative(n)->valueAt(t); }
+template <typename Scalar>
+PointT<Scalar> CurveT<Scalar>::derivativeAt(uint n, Scalar t) const { return derivative(n)->valueAt(t); }
 
-PointVector Curve::roots(double step, double epsilon, std::size_t max_iter) const
+template <typename Scalar>
+typename CurveT<Scalar>::MatrixX2 CurveT<Scalar>::derivativeAt(const VectorX& t_vector) const
 {
-  if (!cached_roots_ || cached_roots_params_ != std::make_tuple(step, epsilon, max_iter))
-  {
-    (const_cast<Curve*>(this))->cached_roots_params_ = std::make_tuple(step, epsilon, max_iter);
-    (const_cast<Curve*>(this))->cached_roots_.reset(new PointVector());
-    std::vector<double> added_t;
+  return derivative()->valueAt(t_vector);
+}
+
+template <typename Scalar>
+typename CurveT<Scalar>::MatrixX2 CurveT<Scalar>::derivativeAt(uint n, const VectorX& t_vector) const
+{
+  return derivative(n)->valueAt(t_vector);
+}
+
+template <typename Scalar> typename CurveT<Scalar>::MatrixX2 CurveT<Scalar>::jetAt(Scalar t, uint k) const
+{
+  MatrixX2 jet(k + 1, 2);
+  jetAt(t, jet);
+  return jet;
+}
+
+template <typename Scalar> void CurveT<Scalar>::jetAt(Scalar t, Eigen::Ref<MatrixX2> jet) const
+{
+  jet.setZero();
+  if (N_ == 0 || jet.rows() == 0)
+    return;
 
-    // check both axes
-    for (uint k = 0; k < 2; k++)
+  if (evaluator_ == Evaluator::DeCasteljau)
+  {
+    if (N_ <= DeCasteljauBuffer<Scalar>::MaxRowsAtCompileTime)
     {
-      double t = 0;
-      while (t <= 1.0)
-      {
-        double t_halley = t;
-        std::size_t current_iter = 0;
+      DeCasteljauBuffer<Scalar> points(control_points_), differences(N_, 2);
+      deCasteljauJet(points, differences, t, jet);
+    }
+    else
+    {
+      MatrixX2 points(control_points_), differences(N_, 2);
+      deCasteljauJet(points, differences, t, jet);
+    }
+    return;
+  }
 
-        // it has to converge in max_iter steps
-        while (current_iter < max_iter)
-        {
-          // Halley
-          double f = derivativeAt(t_halley)[k];
-          double f_d = derivativeAt(2, t_halley)[k];
-          double f_d2 = derivativeAt(2, t).norm();
-
-          t_halley -= (2 * f * f_d) / (2 * f_d * f_d - f * f_d2);
-          // if there is no change to t_current
-          if (std::fabs(f) < epsilon)
-          {
-            // check if between [0, 1]
-            if (t_halley >= 0.0 && t_halley <= 1.0)
-            {
-              // check if same value wasn't found before
-              if (added_t.end() == std::find_if(added_t.begin(), added_t.end(), [t_halley, epsilon](const double& val) {
-                    return std::fabs(val - t_halley) < epsilon;
-                  }))
-              {
-                // add new value and point
-                added_t.push_back(t_halley);
-                (const_cast<Curve*>(this))->cached_roots_->push_back(valueAt(t_halley));
-              }
-            }
-
-            // this t_halley converged
-            break;
-          }
-
-          current_iter++;
-        }
+  // Horner's method extended to derivatives (Taylor coefficients)
+  const MatrixX2& coeffs = powerCoeffs();
+  const uint k = static_cast<uint>(jet.rows()) - 1;
+  jet.row(0) = coeffs.row(N_ - 1);
+  for (uint i = N_ - 1; i > 0; i--)
+  {
+    for (uint j = std::min(k, N_ - i); j > 0; j--)
+      jet.row(j) = jet.row(j) * t + jet.row(j - 1);
+    jet.row(0) = jet.row(0) * t + coeffs.row(i - 1);
+  }
+
+  // Taylor coefficients to derivatives
+  Scalar factorial = 1;
+  for (uint j = 2; j <= k; j++)
+    jet.row(j) *= (factorial *= j);
+}
+
+template <typename Scalar>
+PointVectorT<Scalar> CurveT<Scalar>::roots(Scalar /*step*/, Scalar epsilon, std::size_t max_iter) const
+{
+  return rootsCache(epsilon, max_iter)->second.second;
+}
+
+template <typename Scalar>
+std::shared_ptr<const typename CurveT<Scalar>::RootsCache> CurveT<Scalar>::rootsCache(Scalar epsilon,
+                                                                                     std::size_t max_iter) const
+{
+  auto cached_roots = std::atomic_load(&cached_roots_);
+  if (!cached_roots || cached_roots->first != std::make_tuple(epsilon, max_iter))
+  {
+    std::vector<Scalar> roots_t;
 
-        t += step;
+    if (N_ <= 5)
+    {
+      // analytic roots of derivative for curves up to order 4 (linear curves have none)
+      for (uint k = 0; k < 2 && N_ > 2; k++)
+      {
+        const MatrixX2& derivative_coeffs = derivative()->powerCoeffs();
+        Scalar coeffs[4], roots[3];
+        for (uint i = 0; i < N_ - 1; i++)
+          coeffs[i] = derivative_coeffs(i, k);
+        const uint count = polynomialRoots(coeffs, N_ - 2, roots);
+        for (uint i = 0; i < count; i++)
+          if (roots[i] >= 0.0 && roots[i] <= 1.0)
+            roots_t.push_back(roots[i]);
       }
     }
+    else
+    {
+      // isolate roots on Bernstein coefficients of derivative (scaled by 1 / (N_ - 1))
+      // bernsteinRoots consumes coefficients, so they are set per axis
+      std::vector<Scalar> coeffs;
+      for (uint k = 0; k < 2; k++)
+      {
+        coeffs.assign(N_ - 1, 0);
+        for (uint i = 0; i < N_ - 1; i++)
+          coeffs[i] = control_points_(i + 1, k) - control_points_(i, k);
+        // constant coordinate has no extremes
+        if (std::all_of(coeffs.begin(), coeffs.end(), [](Scalar c) { return c == 0; }))
+          continue;
+        bernsteinRoots(coeffs, coeffs.size(), Scalar(0), Scalar(1), epsilon, max_iter,
+                       [&roots_t](Scalar t) { roots_t.push_back(t); });
+      }
+    }
+
+    // merge roots of both axes, keeping one of those closer than epsilon
+    std::sort(roots_t.begin(), roots_t.end());
+    roots_t.erase(std::unique(roots_t.begin(), roots_t.end(),
+                              [epsilon](Scalar t1, Scalar t2) { return std::fabs(t2 - t1) < epsilon; }),
+                  roots_t.end());
+
+    PointVector points;
+    points.reserve(roots_t.size());
+    for (Scalar t : roots_t)
+      points.push_back(valueAt(t));
+    auto new_cache = std::make_shared<RootsCache>(std::make_tuple(epsilon, max_iter),
+                                                  std::make_pair(std::move(roots_t), std::move(points)));
+
+    cached_roots = new_cache;
+    std::atomic_store(&cached_roots_, cached_roots);
+  }
+  return cached_roots;
+}
+
+template <typename Scalar> std::vector<Scalar> CurveT<Scalar>::inflections(Scalar epsilon, std::size_t max_iter) const
+{
+  auto cached_inflections = std::atomic_load(&cached_inflections_);
+  if (!cached_inflections || cached_inflections->first != std::make_tuple(epsilon, max_iter))
+  {
+    cached_inflections = std::make_shared<ParametersCache>(std::make_tuple(epsilon, max_iter),
+                                                           curvatureRoots(false, epsilon, max_iter));
+    std::atomic_store(&cached_inflections_, cached_inflections);
   }
-  return *cached_roots_;
+  return cached_inflections->second;
 }
 
-BoundingBox Curve::boundingBox(bool use_roots) const
+template <typename Scalar>
+std::vector<Scalar> CurveT<Scalar>::curvatureExtrema(Scalar epsilon, std::size_t max_iter) const
 {
-  if (!(use_roots ? cached_bounding_box_tight_ : cached_bounding_box_relaxed_))
+  auto cached_extrema = std::atomic_load(&cached_curvature_extrema_);
+  if (!cached_extrema || cached_extrema->first != std::make_tuple(epsilon, max_iter))
   {
-    PointVector extremes;
-    if (use_roots)
+    cached_extrema = std::make_shared<ParametersCache>(std::make_tuple(epsilon, max_iter),
+                                                       curvatureRoots(true, epsilon, max_iter));
+    std::atomic_store(&cached_curvature_extrema_, cached_extrema);
+  }
+  return cached_extrema->second;
+}
+
+template <typename Scalar>
+std::vector<Scalar> CurveT<Scalar>::curvatureRoots(bool extrema, Scalar epsilon, std::size_t max_iter) const
+{
+  std::vector<Scalar> roots_t;
+  // lines have no curvature
+  if (N_ < 3)
+    return roots_t;
+
+  // Bernstein coefficients of first and second derivative per axis
+  const uint degree = N_ - 1;
+  std::vector<Scalar> d1[2], d2[2];
+  for (uint k = 0; k < 2; k++)
+  {
+    d1[k].resize(degree);
+    for (uint i = 0; i < degree; i++)
+      d1[k][i] = degree * (control_points_(i + 1, k) - control_points_(i, k));
+    d2[k] = bernsteinDerivative(d1[k]);
+  }
+
+  // curvature is cross / speed^3, inflections are roots of cross
+  std::vector<Scalar> cross = bernsteinProduct(d1[0], d2[1]);
+  const std::vector<Scalar> cross_yx = bernsteinProduct(d1[1], d2[0]);
+  for (std::size_t k = 0; k < cross.size(); k++)
+    cross[k] -= cross_yx[k];
+
+  // straight curve (up to rounding) has neither inflections nor curvature extrema
+  auto max_abs = [](const std::vector<Scalar>& a) {
+    Scalar max = 0;
+    for (Scalar c : a)
+      max = std::max(max, std::fabs(c));
+    return max;
+  };
+  const Scalar scale = std::max(max_abs(d1[0]), max_abs(d1[1])) * std::max(max_abs(d2[0]), max_abs(d2[1]));
+  if (max_abs(cross) <= 64 * std::numeric_limits<Scalar>::epsilon() * scale)
+    return roots_t;
+
+  std::vector<Scalar> coeffs;
+  if (!extrema)
+    coeffs = std::move(cross);
+  else
+  {
+    // derivative of curvature vanishes where cross' * speed^2 - 3 * cross * (d1 . d2) does
+    std::vector<Scalar> speed_2 = bernsteinProduct(d1[0], d1[0]), dot = bernsteinProduct(d1[0], d2[0]);
+    const std::vector<Scalar> speed_2_y = bernsteinProduct(d1[1], d1[1]), dot_y = bernsteinProduct(d1[1], d2[1]);
+    for (std::size_t k = 0; k < speed_2.size(); k++)
+      speed_2[k] += speed_2_y[k];
+    for (std::size_t k = 0; k < dot.size(); k++)
+      dot[k] += dot_y[k];
+
+    coeffs = bernsteinProduct(bernsteinDerivative(cross), speed_2);
+    const std::vector<Scalar> cross_dot = bernsteinProduct(cross, dot);
+    for (std::size_t k = 0; k < coeffs.size(); k++)
+      coeffs[k] -= 3 * cross_dot[k];
+    if (max_abs(coeffs) == 0)
+      return roots_t;
+  }
+
+  bernsteinRoots(coeffs, coeffs.size(), Scalar(0), Scalar(1), epsilon, max_iter,
+                 [&roots_t](Scalar t) { roots_t.push_back(t); });
+
+  // keep interior roots, merging those closer than epsilon
+  roots_t.erase(std::remove_if(roots_t.begin(), roots_t.end(), [](Scalar t) { return t <= 0 || t >= 1; }),
+                roots_t.end());
+  roots_t.erase(std::unique(roots_t.begin(), roots_t.end(),
+                            [epsilon](Scalar t1, Scalar t2) { return std::fabs(t2 - t1) < epsilon; }),
+                roots_t.end());
+  return roots_t;
+}
+
+template <typename Scalar> BoundingBoxT<Scalar> CurveT<Scalar>::boundingBox(bool use_roots) const
+{
+  return (use_roots ? cached_bounding_box_tight_ : cached_bounding_box_relaxed_).get([this, use_roots] {
+    return computeBoundingBox(control_points_, use_roots);
+  });
+}
+
+template <typename Scalar> PointVectorT<Scalar> CurveT<Scalar>::orientedBoundingBox() const
+{
+  return cached_oriented_bounding_box_.get([this] {
+    // axes along and perpendicular to chord
+    Vector u = control_points_.row(N_ - 1) - control_points_.row(0);
+    u = u.norm() > 0 ? Vector(u.normalized()) : Vector(1, 0);
+    const Vector v(-u.y(), u.x());
+
+    const VectorX along = control_points_ * u, across = control_points_ * v;
+    const Scalar u_min = along.minCoeff(), u_max = along.maxCoeff();
+    const Scalar v_min = across.minCoeff(), v_max = across.maxCoeff();
+    return PointVector{u * u_min + v * v_min, u * u_max + v * v_min, u * u_max + v * v_max, u * u_min + v * v_max};
+  });
+}
+
+template <typename Scalar> PointVectorT<Scalar> CurveT<Scalar>::convexHull() const
+{
+  return cached_convex_hull_.get([this] { return ::convexHull(control_points_); });
+}
+
+template <typename Scalar>
+BoundingBoxT<Scalar> CurveT<Scalar>::computeBoundingBox(const MatrixX2& control_points, bool use_roots)
+{
+  const uint N = static_cast<uint>(control_points.rows());
+  BoundingBox bbox;
+  if (!use_roots)
+  {
+    for (uint k = 0; k < N; k++)
+      bbox.extend(Point(control_points.row(k)));
+    return bbox;
+  }
+
+  bbox.extend(Point(control_points.row(0)));
+  bbox.extend(Point(control_points.row(N - 1)));
+  if (N < 3)
+    return bbox;
+
+  // value at extreme is only second order sensitive to error of t
+  const Scalar epsilon = std::sqrt(std::numeric_limits<Scalar>::epsilon());
+  std::vector<Scalar> coeffs, roots_t;
+  // workspace of de Casteljau's algorithm, allocated only for high orders
+  Scalar stack_buffer[5];
+  std::vector<Scalar> heap_buffer(N > 5 ? N : 0);
+  Scalar* buffer = N > 5 ? heap_buffer.data() : stack_buffer;
+
+  // extremes of each axis are at roots of its derivative
+  for (uint k = 0; k < 2; k++)
+  {
+    roots_t.clear();
+    if (N <= 5)
     {
-      extremes = roots();
-      extremes.push_back(control_points_.row(0));
-      extremes.push_back(control_points_.row(N_ - 1));
+      // derivative from Bernstein to power basis, solved analytically
+      const uint degree = N - 2;
+      Scalar power[4], roots[3];
+      Scalar binomial_degree = 1;
+      for (uint j = 0; j <= degree; j++)
+      {
+        Scalar sum = 0, binomial_j = 1;
+        for (uint i = j + 1; i-- > 0;)
+        {
+          sum += ((j - i) % 2 ? -1 : 1) * binomial_j * (control_points(i + 1, k) - control_points(i, k));
+          binomial_j = binomial_j * i / (j - i + 1);
+        }
+        power[j] = binomial_degree * sum;
+        binomial_degree = binomial_degree * (degree - j) / (j + 1);
+      }
+      const uint count = polynomialRoots(power, degree, roots);
+      roots_t.assign(roots, roots + count);
     }
     else
     {
-      for (uint k = 0; k < control_points_.rows(); k++)
-        extremes.push_back(control_points_.row(k));
+      coeffs.resize(N - 1);
+      for (uint i = 0; i < N - 1; i++)
+        coeffs[i] = control_points(i + 1, k) - control_points(i, k);
+      // constant coordinate has no extremes
+      if (std::any_of(coeffs.begin(), coeffs.end(), [](Scalar c) { return c != 0; }))
+        bernsteinRoots(coeffs, coeffs.size(), Scalar(0), Scalar(1), epsilon, 15,
+                       [&roots_t](Scalar t) { roots_t.push_back(t); });
     }
 
-    // find mininum and maximum along each axis
-    auto x_extremes = std::minmax_element(extremes.begin(), extremes.end(),
-                                          [](const Point& lhs, const Point& rhs) { return lhs.x() < rhs.x(); });
-    auto y_extremes = std::minmax_element(extremes.begin(), extremes.end(),
-                                          [](const Point& lhs, const Point& rhs) { return lhs.y() < rhs.y(); });
-    (use_roots ? (const_cast<Curve*>(this))->cached_bounding_box_tight_
-               : (const_cast<Curve*>(this))->cached_bounding_box_relaxed_)
-        .reset(new BoundingBox(Point(x_extremes.first->x(), y_extremes.first->y()),
-                               Point(x_extremes.second->x(), y_extremes.second->y())));
+    for (Scalar t : roots_t)
+    {
+      if (t <= 0 || t >= 1)
+        continue;
+      // de Casteljau's algorithm on a single axis
+      for (uint i = 0; i < N; i++)
+        buffer[i] = control_points(i, k);
+      for (uint n = N - 1; n > 0; n--)
+        for (uint i = 0; i < n; i++)
+          buffer[i] = (1 - t) * buffer[i] + t * buffer[i + 1];
+      bbox.min()(k) = std::min(bbox.min()(k), buffer[0]);
+      bbox.max()(k) = std::max(bbox.max()(k), buffer[0]);
+    }
+  }
+  return bbox;
+}
+
+template <typename Scalar>
+void CurveT<Scalar>::computeBoundingBoxes(const CurveT* curves, std::size_t count, BoundingBox* boxes, bool use_roots)
+{
+  for (std::size_t k = 0; k < count; k++)
+    boxes[k] = computeBoundingBox(curves[k].control_points_, use_roots);
+}
+
+template <typename Scalar> std::pair<CurveT<Scalar>, CurveT<Scalar>> CurveT<Scalar>::splitCurve(Scalar z) const
+{
+  std::pair<CurveT, CurveT> subcurves{control_points_, control_points_};
+  deCasteljauSplit(control_points_, z, subcurves.first.control_points_, subcurves.second.control_points_);
+  subcurves.first.evaluator_ = subcurves.second.evaluator_ = evaluator_;
+  subcurves.first.quadrature_nodes_ = subcurves.second.quadrature_nodes_ = quadrature_nodes_;
+  subcurves.first.arc_length_intervals_ = subcurves.second.arc_length_intervals_ = arc_length_intervals_;
+  return subcurves;
+}
+
+template <typename Scalar>
+void CurveT<Scalar>::splitCurve(Scalar z, Eigen::Ref<MatrixX2> left, Eigen::Ref<MatrixX2> right) const
+{
+  if (left.rows() != N_ || right.rows() != N_)
+    throw std::invalid_argument{"Storage for subcurves must have a row for each control point."};
+  deCasteljauSplit(control_points_, z, left, right);
+}
+
+template <typename Scalar> PolyCurveT<Scalar> CurveT<Scalar>::splitCurve(const std::vector<Scalar>& t_vector) const
+{
+  if (!std::is_sorted(t_vector.begin(), t_vector.end()) ||
+      (!t_vector.empty() && (t_vector.front() < 0 || t_vector.back() > 1)))
+    throw std::invalid_argument{"Parameters for splitting must be in ascending order and in range [0, 1]."};
+
+  // each cut splits off the left part of the rest of the curve, so consecutive subcurves share exact end points
+  std::deque<std::shared_ptr<CurveT>> subcurves;
+  auto rest = std::make_shared<CurveT>(*this);
+  Scalar t_prev = 0;
+  for (Scalar t : t_vector)
+  {
+    auto subcurve = std::make_shared<CurveT>(*this);
+    Scalar z = t_prev < 1 ? (t - t_prev) / (1 - t_prev) : 0;
+    deCasteljauSplit(rest->control_points_, z, subcurve->control_points_, rest->control_points_);
+    subcurves.push_back(std::move(subcurve));
+    t_prev = t;
   }
-  return *(use_roots ? cached_bounding_box_tight_ : cached_bounding_box_relaxed_);
+  subcurves.push_back(std::move(rest));
+  return PolyCurveT<Scalar>(std::move(subcurves));
 }
 
-std::pair<Curve, Curve> Curve::splitCurve(double z) const
+template <typename Scalar> CurveT<Scalar> CurveT<Scalar>::subCurve(Scalar t1, Scalar t2) const
 {
-  return std::make_pair(Curve(splittingCoeffsLeft(z) * control_points_),
-                        Curve(splittingCoeffsRight(z) * control_points_));
+  // control points of subcurve are values of blossom with arguments t1 and t2, evaluated by de Casteljau
+  CurveT subcurve(*this);
+  deCasteljauInterval(subcurve.control_points_, std::min(t1, t2), std::max(t1, t2));
+  if (t1 > t2)
+    subcurve.reverse();
+  return subcurve;
 }
 
-PointVector Curve::pointsOfIntersection(const Curve& curve, bool stop_at_first, double epsilon) const
+template <typename Scalar>
+PointVectorT<Scalar> CurveT<Scalar>::pointsOfIntersection(const CurveT& curve, bool stop_at_first, Scalar epsilon) const
 {
   PointVector points_of_intersection;
 
-  std::vector<std::pair<Eigen::MatrixX2d, Eigen::MatrixX2d>> subcurve_pairs;
+  // subcurve with its bounding box and convex hull, computed once when it is created and shared by its pairs
+  struct Part
+  {
+    MatrixX2 points;
+    BoundingBox bbox;
+    PointVector hull;
+  };
+  auto make_part = [](MatrixX2 points) {
+    auto part = std::make_shared<Part>();
+    part->bbox = BoundingBox(Point(points.col(0).minCoeff(), points.col(1).minCoeff()),
+                             Point(points.col(0).maxCoeff(), points.col(1).maxCoeff()));
+    part->hull = ::convexHull(points);
+    part->points = std::move(points);
+    return std::shared_ptr<const Part>(std::move(part));
+  };
+
+  std::vector<std::pair<std::shared_ptr<const Part>, std::shared_ptr<const Part>>> subcurve_pairs;
 
   if (this != &curve)
   {
-    subcurve_pairs.emplace_back(control_points_, curve.control_points_);
+    subcurve_pairs.emplace_back(make_part(control_points_), make_part(curve.control_points_));
   }
   else
   {
     // self intersections
 
-    // get all inflection points (roots)
-    std::map<double, Point> t_point_pair;
-    for (const auto& root : roots())
-      t_point_pair.insert(std::make_pair(projectPoint(root), root));
+    // get parameters of all extreme points (roots), already sorted
+    auto cached_roots = rootsCache(0.001, 15);
+    const std::vector<Scalar>& roots_t = cached_roots->second.first;
 
-    // divide curve into subcurves at inflection points
-    std::vector<Eigen::MatrixX2d> subcurves;
-    for (const auto& root_pair : t_point_pair)
+    // divide curve into subcurves (monotone on both axes) at extreme points
+    std::vector<MatrixX2> subcurves{control_points_};
+    Scalar t_start = 0; // parameter t where the last subcurve starts
+    for (Scalar t : roots_t)
     {
-      if (subcurves.empty())
-      {
-        subcurves.emplace_back(splittingCoeffsLeft(root_pair.first - epsilon / 2) * control_points_);
-        subcurves.emplace_back(splittingCoeffsRight(root_pair.first + epsilon / 2) * control_points_);
-      }
-      else
-      {
-        Curve temp_curve(subcurves.back());
-        double new_t = temp_curve.projectPoint(root_pair.second);
-        auto new_cp = subcurves.back();
-        subcurves.pop_back();
-        subcurves.emplace_back(splittingCoeffsLeft(new_t - epsilon / 2) * new_cp);
-        subcurves.emplace_back(splittingCoeffsRight(new_t + epsilon / 2) * new_cp);
-      }
+      // parameter of extreme point on the last subcurve
+      Scalar new_t = (t - t_start) / (1 - t_start);
+      MatrixX2 right = subcurves.back();
+      deCasteljauLeft(subcurves.back(), new_t - epsilon / 2);
+      deCasteljauRight(right, new_t + epsilon / 2);
+      subcurves.push_back(std::move(right));
+      t_start = t + epsilon / 2;
     }
 
     // create all pairs of subcurves
-    for (uint k = 0; k < subcurves.size(); k++)
-      for (uint i = k + 1; i < subcurves.size(); i++)
-        subcurve_pairs.emplace_back(subcurves[k], subcurves[i]);
+    std::vector<std::shared_ptr<const Part>> parts;
+    for (auto& subcurve : subcurves)
+      parts.push_back(make_part(std::move(subcurve)));
+    for (uint k = 0; k < parts.size(); k++)
+      for (uint i = k + 1; i < parts.size(); i++)
+        subcurve_pairs.emplace_back(parts[k], parts[i]);
   }
 
-  auto bbox = [](Eigen::MatrixX2d cp) {
-    return BoundingBox(Point(cp.col(0).minCoeff(), cp.col(1).minCoeff()),
-                       Point(cp.col(0).maxCoeff(), cp.col(1).maxCoeff()));
-  };
-
   while (!subcurve_pairs.empty())
   {
-    Eigen::MatrixX2d part_a = std::get<0>(subcurve_pairs.back());
-    Eigen::MatrixX2d part_b = std::get<1>(subcurve_pairs.back());
+    const std::shared_ptr<const Part> part_a = std::move(subcurve_pairs.back().first);
+    const std::shared_ptr<const Part> part_b = std::move(subcurve_pairs.back().second);
     subcurve_pairs.pop_back();
 
-    BoundingBox bbox1 = bbox(part_a);
-    BoundingBox bbox2 = bbox(part_b);
+    const BoundingBox& bbox1 = part_a->bbox;
+    const BoundingBox& bbox2 = part_b->bbox;
     if (!bbox1.intersects(bbox2))
     {
       // no intersection
@@ -517,12 +1616,16 @@ PointVector Curve::pointsOfIntersection(const Curve& curve, bool stop_at_first,
       continue;
     }
 
+    // convex hulls are much tighter than axis aligned boxes for diagonal and thin parts
+    if (separated(part_a->hull, part_b->hull))
+      continue;
+
     // intersection exists, but segments are still too large
     // divide both segments in half and new pairs
     // LIFO : we want to first discover closest intersection (smallest t on this curve)
     // so it is important which pair of subcurves is inserted first
-    std::vector<Eigen::MatrixX2d> subcurves_a;
-    std::vector<Eigen::MatrixX2d> subcurves_b;
+    std::vector<std::shared_ptr<const Part>> subcurves_a;
+    std::vector<std::shared_ptr<const Part>> subcurves_b;
 
     if (bbox1.diagonal().norm() < epsilon)
     {
@@ -533,8 +1636,8 @@ PointVector Curve::pointsOfIntersection(const Curve& curve, bool stop_at_first,
     {
       // divide into two subcurves
       // first insert 2nd subcurve t = [0.5 to 1]
-      subcurves_a.emplace_back(splittingCoeffsRight() * part_a);
-      subcurves_a.emplace_back(splittingCoeffsLeft() * part_a);
+      subcurves_a.push_back(make_part(splittingCoeffsRight() * part_a->points));
+      subcurves_a.push_back(make_part(splittingCoeffsLeft() * part_a->points));
     }
 
     if (bbox2.diagonal().norm() < epsilon)
@@ -546,8 +1649,8 @@ PointVector Curve::pointsOfIntersection(const Curve& curve, bool stop_at_first,
     else
     {
       // divide into two subcurves
-      subcurves_b.emplace_back(curve.splittingCoeffsRight() * part_b);
-      subcurves_b.emplace_back(curve.splittingCoeffsLeft() * part_b);
+      subcurves_b.push_back(make_part(curve.splittingCoeffsRight() * part_b->points));
+      subcurves_b.push_back(make_part(curve.splittingCoeffsLeft() * part_b->points));
     }
 
     // insert all combinations for next iteration
@@ -560,18 +1663,19 @@ PointVector Curve::pointsOfIntersection(const Curve& curve, bool stop_at_first,
   return points_of_intersection;
 }
 
-double Curve::projectPoint(const Point& point, double step, double epsilon, std::size_t max_iter) const
+template <typename Scalar>
+Scalar CurveT<Scalar>::projectPoint(const Point& point, Scalar step, Scalar epsilon, std::size_t max_iter) const
 {
-  step = std::max(step, 0.01);
-  epsilon = std::max(epsilon, 0.001);
+  step = std::max(step, Scalar(0.01));
+  epsilon = std::max(epsilon, Scalar(0.001));
 
-  double t = 0;
-  double t_dist = (valueAt(t) - point).norm();
+  Scalar t = 0;
+  Scalar t_dist = (valueAt(t) - point).norm();
 
   // Coarse search
-  for (double k = step; k < 1 + step; k += step)
+  for (Scalar k = step; k < 1 + step; k += step)
   {
-    double new_dist = (valueAt(k) - point).norm();
+    Scalar new_dist = (valueAt(k) - point).norm();
     if (new_dist < t_dist)
     {
       t_dist = new_dist;
@@ -582,17 +1686,19 @@ double Curve::projectPoint(const Point& point, double step, double epsilon, std:
   // Fine search - Halley
   // function to minimize is a dot product between projection vector and tangent
   // - projection vector is a vector between point we are projecting and our current guess
-  double t_old = t;
+  Scalar t_old = t;
   std::size_t current_iter = 0;
   while (current_iter < max_iter)
   {
-    Point P = valueAt(t);
-    Point d1 = derivativeAt(t);
-    Point d2 = derivativeAt(2, t);
-    Point d3 = derivativeAt(3, t);
-    double f = (P - point).dot(d1);
-    double f_d = (P - point).dot(d2) + d1.dot(d1);
-    double f_d2 = (P - point).dot(d3) + 3 * d1.dot(d2);
+    Eigen::Matrix<Scalar, 4, 2> jet;
+    jetAt(t, jet);
+    Point P = jet.row(0);
+    Point d1 = jet.row(1);
+    Point d2 = jet.row(2);
+    Point d3 = jet.row(3);
+    Scalar f = (P - point).dot(d1);
+    Scalar f_d = (P - point).dot(d2) + d1.dot(d1);
+    Scalar f_d2 = (P - point).dot(d3) + 3 * d1.dot(d2);
     t -= (2 * f * f_d) / (2 * f_d * f_d - f * f_d2);
     if (t < 0 || t > 1)
     {
@@ -610,15 +1716,16 @@ double Curve::projectPoint(const Point& point, double step, double epsilon, std:
   return t;
 }
 
-void Curve::applyContinuity(const Curve& source_curve, std::vector<double>& beta_coeffs)
+template <typename Scalar>
+void CurveT<Scalar>::applyContinuity(const CurveT& source_curve, std::vector<Scalar>& beta_coeffs)
 {
   uint c_order = beta_coeffs.size();
 
-  Eigen::MatrixXd pascal_alterating_matrix(Eigen::MatrixXd::Zero(c_order + 1, c_order + 1));
-  pascal_alterating_matrix.diagonal(-1) = -Eigen::ArrayXd::LinSpaced(c_order, 1, c_order);
+  Coeffs pascal_alterating_matrix(Coeffs::Zero(c_order + 1, c_order + 1));
+  pascal_alterating_matrix.diagonal(-1) = -ArrayX::LinSpaced(c_order, 1, c_order);
   pascal_alterating_matrix = pascal_alterating_matrix.exp();
 
-  Eigen::MatrixXd bell_matrix(Eigen::MatrixXd::Zero(c_order + 1, c_order + 1));
+  Coeffs bell_matrix(Coeffs::Zero(c_order + 1, c_order + 1));
   bell_matrix(0, c_order) = 1;
 
   for (uint i = 0; i < c_order; i++)
@@ -628,26 +1735,58 @@ void Curve::applyContinuity(const Curve& source_curve, std::vector<double>& beta
         pascal_alterating_matrix.block(i, 0, 1, i + 1)
             .cwiseAbs()
             .transpose()
-            .cwiseProduct(Eigen::Map<Eigen::MatrixXd>(beta_coeffs.data(), i + 1, 1));
+            .cwiseProduct(Eigen::Map<Coeffs>(beta_coeffs.data(), i + 1, 1));
   }
 
-  Eigen::MatrixXd factorial_matrix(Eigen::MatrixXd::Zero(c_order + 1, c_order + 1));
+  Coeffs factorial_matrix(Coeffs::Zero(c_order + 1, c_order + 1));
   for (uint i = 0; i < c_order + 1; i++)
   {
     factorial_matrix(i, i) = factorial(N_ - 1) / factorial(N_ - 1 - i);
   }
 
-  Eigen::MatrixXd derivatives(Eigen::MatrixXd::Zero(2, c_order + 1));
+  Coeffs derivatives(Coeffs::Zero(2, c_order + 1));
   derivatives.col(0) = source_curve.valueAt(1);
   for (uint i = 1; i < c_order + 1; i++)
     derivatives.col(i) = source_curve.derivativeAt(i, 1);
 
-  Eigen::MatrixXd derivatives_wanted = (derivatives * bell_matrix).rowwise().reverse().transpose();
+  Coeffs derivatives_wanted = (derivatives * bell_matrix).rowwise().reverse().transpose();
 
-  Eigen::MatrixXd control_points = (factorial_matrix * pascal_alterating_matrix).inverse() * derivatives_wanted;
+  Coeffs control_points = (factorial_matrix * pascal_alterating_matrix).inverse() * derivatives_wanted;
 
   for (uint i = 0; i < c_order + 1; i++)
   {
     manipulateControlPoint(i, control_points.row(i));
   }
 }
+
+template <typename Scalar>
+void Bezier::boundingBoxes(const CurveT<Scalar>* curves, std::size_t count, BoundingBoxT<Scalar>* boxes, bool use_roots,
+                           uint threads)
+{
+  // starting a thread is not worth it for less than a few thousand curves
+  const std::size_t min_chunk = 4096;
+  if (threads == 0)
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  threads = static_cast<uint>(std::max<std::size_t>(1, std::min<std::size_t>(threads, count / min_chunk)));
+
+  const std::size_t chunk = (count + threads - 1) / threads;
+  std::vector<std::thread> workers;
+  workers.reserve(threads - 1);
+  for (uint k = 1; k < threads; k++)
+  {
+    const std::size_t begin = std::min(count, k * chunk);
+    workers.emplace_back(&CurveT<Scalar>::computeBoundingBoxes, curves + begin, std::min(chunk, count - begin),
+                         boxes + begin, use_roots);
+  }
+  CurveT<Scalar>::computeBoundingBoxes(curves, std::min(chunk, count), boxes, use_roots);
+  for (auto& worker : workers)
+    worker.join();
+}
+
+namespace Bezier
+{
+template class CurveT<double>;
+template class CurveT<float>;
+template void boundingBoxes(const CurveT<double>*, std::size_t, BoundingBoxT<double>*, bool, uint);
+template void boundingBoxes(const CurveT<float>*, std::size_t, BoundingBoxT<float>*, bool, uint);
+} // namespace Bezier
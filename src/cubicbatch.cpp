@@ -0,0 +1,92 @@
+#include "Bezier/cubicbatch.h"
+#include "Bezier/bezier.h"
+
+using namespace Bezier;
+
+CubicBatch::CubicBatch(const std::vector<Curve>& curves)
+{
+  for (uint k = 0; k < 4; k++)
+  {
+    x_[k].resize(static_cast<Eigen::Index>(curves.size()));
+    y_[k].resize(static_cast<Eigen::Index>(curves.size()));
+  }
+  for (uint idx = 0; idx < curves.size(); idx++)
+    setCurve(idx, curves[idx]);
+}
+
+uint CubicBatch::size() const { return static_cast<uint>(x_[0].size()); }
+
+Curve CubicBatch::curve(uint idx) const
+{
+  Eigen::Matrix<double, 4, 2> points;
+  for (uint k = 0; k < 4; k++)
+    points.row(k) << x_[k](idx), y_[k](idx);
+  return Curve(Eigen::MatrixX2d(points));
+}
+
+std::vector<Curve> CubicBatch::curves() const
+{
+  std::vector<Curve> curves;
+  curves.reserve(size());
+  for (uint idx = 0; idx < size(); idx++)
+    curves.push_back(curve(idx));
+  return curves;
+}
+
+void CubicBatch::setCurve(uint idx, const Curve& curve)
+{
+  PointVector points = curve.controlPoints();
+  if (points.size() != 4)
+    throw std::invalid_argument{"Only cubic curves can be stored in a CubicBatch."};
+  for (uint k = 0; k < 4; k++)
+  {
+    x_[k](idx) = points[k].x();
+    y_[k](idx) = points[k].y();
+  }
+}
+
+Eigen::MatrixX2d CubicBatch::valueAt(double t) const
+{
+  // Bernstein basis
+  const double b0 = (1 - t) * (1 - t) * (1 - t);
+  const double b1 = 3 * t * (1 - t) * (1 - t);
+  const double b2 = 3 * t * t * (1 - t);
+  const double b3 = t * t * t;
+
+  Eigen::MatrixX2d values(size(), 2);
+  values.col(0) = (b0 * x_[0] + b1 * x_[1] + b2 * x_[2] + b3 * x_[3]).matrix();
+  values.col(1) = (b0 * y_[0] + b1 * y_[1] + b2 * y_[2] + b3 * y_[3]).matrix();
+  return values;
+}
+
+Eigen::MatrixX2d CubicBatch::derivativeAt(double t) const
+{
+  // Bernstein basis of the derivative (quadratic), expressed on the control points
+  const double b0 = 3 * (1 - t) * (1 - t);
+  const double b1 = 6 * t * (1 - t);
+  const double b2 = 3 * t * t;
+
+  Eigen::MatrixX2d derivatives(size(), 2);
+  derivatives.col(0) = (b0 * (x_[1] - x_[0]) + b1 * (x_[2] - x_[1]) + b2 * (x_[3] - x_[2])).matrix();
+  derivatives.col(1) = (b0 * (y_[1] - y_[0]) + b1 * (y_[2] - y_[1]) + b2 * (y_[3] - y_[2])).matrix();
+  return derivatives;
+}
+
+Eigen::VectorXd CubicBatch::curvatureAt(double t) const
+{
+  // first derivative (quadratic), kept as expression so curvature is evaluated in a single pass
+  const double a0 = 3 * (1 - t) * (1 - t);
+  const double a1 = 6 * t * (1 - t);
+  const double a2 = 3 * t * t;
+  const auto d1_x = a0 * (x_[1] - x_[0]) + a1 * (x_[2] - x_[1]) + a2 * (x_[3] - x_[2]);
+  const auto d1_y = a0 * (y_[1] - y_[0]) + a1 * (y_[2] - y_[1]) + a2 * (y_[3] - y_[2]);
+
+  // second derivative (linear)
+  const double b0 = 6 * (1 - t);
+  const double b1 = 6 * t;
+  const auto d2_x = b0 * (x_[2] - 2 * x_[1] + x_[0]) + b1 * (x_[3] - 2 * x_[2] + x_[1]);
+  const auto d2_y = b0 * (y_[2] - 2 * y_[1] + y_[0]) + b1 * (y_[3] - 2 * y_[2] + y_[1]);
+
+  const auto d1_squared_norm = d1_x.square() + d1_y.square();
+  return ((d1_x * d2_y - d1_y * d2_x) / (d1_squared_norm * d1_squared_norm.sqrt())).matrix();
+}
@@ -1,26 +1,127 @@
 #include "Bezier/polycurve.h"
 #include "Bezier/bezier.h"
 
-#include <numeric>
+#include <algorithm>
 #include <utility>
 
 inline double binomial(uint n, uint k) { return tgamma(n + 1) / (tgamma(k + 1) * tgamma(n - k + 1)); }
 
 using namespace Bezier;
 
-PolyCurve::PolyCurve(std::deque<std::shared_ptr<Curve>> curve_list) : curves_(std::move(curve_list)) {}
+/*!
+ * \brief Get distance from point to convex polygon
+ * \param point Point
+ * \param polygon Vertices of polygon in counterclockwise order
+ * \return Distance to polygon (zero if point is inside)
+ */
+template <typename Scalar> Scalar distanceToPolygon(const PointT<Scalar>& point, const PointVectorT<Scalar>& polygon)
+{
+  if (polygon.size() == 1)
+    return (point - polygon.front()).norm();
+
+  bool inside = polygon.size() > 2;
+  Scalar distance = std::numeric_limits<Scalar>::max();
+  for (std::size_t k = 0; k < polygon.size(); k++)
+  {
+    const PointT<Scalar>& a = polygon[k];
+    const VectorT<Scalar> edge = polygon[(k + 1) % polygon.size()] - a;
+    const VectorT<Scalar> to_point = point - a;
+    if (edge.x() * to_point.y() - edge.y() * to_point.x() < 0)
+      inside = false;
+    // distance to edge segment
+    const Scalar t = std::max(Scalar(0), std::min(Scalar(1), to_point.dot(edge) / edge.squaredNorm()));
+    distance = std::min(distance, (to_point - t * edge).norm());
+  }
+  return inside ? 0 : distance;
+}
+
+template <typename Scalar>
+PolyCurveT<Scalar>::PolyCurveT(std::deque<std::shared_ptr<Curve>> curve_list) : curves_(std::move(curve_list))
+{
+  for (auto& curve : curves_)
+    watchCurve(*curve);
+}
 
-PolyCurve::PolyCurve(std::shared_ptr<Curve>& curve) { curves_.push_back(curve); }
+template <typename Scalar> PolyCurveT<Scalar>::PolyCurveT(std::shared_ptr<Curve>& curve)
+{
+  curves_.push_back(curve);
+  watchCurve(*curve);
+}
 
-PolyCurve::PolyCurve(std::vector<std::shared_ptr<Curve>>& curve_list)
+template <typename Scalar> PolyCurveT<Scalar>::PolyCurveT(std::vector<std::shared_ptr<Curve>>& curve_list)
 {
   for (auto& curve_ptr : curve_list)
     insertBack(curve_ptr);
 }
 
-PolyCurve::PolyCurve(const PolyCurve& poly_curve) : PolyCurve(poly_curve.curves_) {}
+template <typename Scalar>
+PolyCurveT<Scalar>::PolyCurveT(const PolyCurveT& poly_curve) : PolyCurveT(poly_curve.curves_)
+{
+  copyCaches(poly_curve);
+}
+
+template <typename Scalar> PolyCurveT<Scalar>& PolyCurveT<Scalar>::operator=(const PolyCurveT& poly_curve)
+{
+  // a new counter, so previous subcurves no longer signal modifications to this polycurve
+  modifications_ = std::make_shared<std::atomic<std::size_t>>(0);
+  curves_ = poly_curve.curves_;
+  for (auto& curve : curves_)
+    watchCurve(*curve);
+  copyCaches(poly_curve);
+  return *this;
+}
+
+template <typename Scalar> void PolyCurveT<Scalar>::watchCurve(Curve& curve) { curve.addOwner(modifications_); }
 
-void PolyCurve::insertAt(uint idx, std::shared_ptr<Curve>& curve)
+template <typename Scalar> void PolyCurveT<Scalar>::copyCaches(const PolyCurveT& poly_curve)
+{
+  // cached data is immutable and validated against versions of subcurves, so it can be shared;
+  // it is known to be up to date here only if it was checked after last modification of the other polycurve
+  const std::size_t other_modifications = poly_curve.modifications_->load(std::memory_order_acquire);
+  const std::size_t modifications = modifications_->load(std::memory_order_acquire);
+  auto copy_checked = [=](const std::atomic<std::size_t>& other_checked, std::atomic<std::size_t>& checked) {
+    checked.store(other_checked.load(std::memory_order_acquire) == other_modifications ? modifications
+                                                                                       : modifications - 1,
+                  std::memory_order_release);
+  };
+
+  std::atomic_store(&cached_cumulative_lengths_, std::atomic_load(&poly_curve.cached_cumulative_lengths_));
+  std::atomic_store(&cached_bounding_boxes_tight_, std::atomic_load(&poly_curve.cached_bounding_boxes_tight_));
+  std::atomic_store(&cached_bounding_boxes_relaxed_, std::atomic_load(&poly_curve.cached_bounding_boxes_relaxed_));
+  copy_checked(poly_curve.lengths_checked_, lengths_checked_);
+  copy_checked(poly_curve.bounding_boxes_tight_checked_, bounding_boxes_tight_checked_);
+  copy_checked(poly_curve.bounding_boxes_relaxed_checked_, bounding_boxes_relaxed_checked_);
+}
+
+template <typename Scalar>
+template <typename Evaluate>
+typename PolyCurveT<Scalar>::MatrixX2 PolyCurveT<Scalar>::evaluateGrouped(const VectorX& t_vector,
+                                                                         Evaluate evaluate) const
+{
+  // group indices of parameters by subcurve
+  std::vector<std::vector<Eigen::Index>> groups(size());
+  for (Eigen::Index k = 0; k < t_vector.size(); k++)
+    groups[curveIdx(t_vector(k))].push_back(k);
+
+  MatrixX2 result(t_vector.size(), 2);
+  for (uint idx = 0; idx < size(); idx++)
+  {
+    const auto& group = groups[idx];
+    if (group.empty())
+      continue;
+
+    VectorX local_t(group.size());
+    for (uint k = 0; k < group.size(); k++)
+      local_t(k) = t_vector(group[k]) - idx;
+
+    MatrixX2 local_result = evaluate(*curves_[idx], local_t);
+    for (uint k = 0; k < group.size(); k++)
+      result.row(group[k]) = local_result.row(k);
+  }
+  return result;
+}
+
+template <typename Scalar> void PolyCurveT<Scalar>::insertAt(uint idx, std::shared_ptr<Curve>& curve)
 {
   Point s_1, s_2, e_1, e_2;
   std::tie(s_1, e_1) = curve->endPoints();
@@ -28,8 +129,8 @@ void PolyCurve::insertAt(uint idx, std::shared_ptr<Curve>& curve)
   {
     std::tie(s_2, e_2) = curves_[idx - 1]->endPoints();
 
-    double s_e = (s_1 - e_2).norm();
-    double e_e = (e_1 - e_2).norm();
+    Scalar s_e = (s_1 - e_2).norm();
+    Scalar e_e = (e_1 - e_2).norm();
 
     if (e_e < s_e) // we need to reverse the curve
     {
@@ -44,8 +145,8 @@ void PolyCurve::insertAt(uint idx, std::shared_ptr<Curve>& curve)
   {
     std::tie(s_2, e_2) = curves_[idx]->endPoints();
 
-    double e_s = (e_1 - s_2).norm();
-    double s_s = (s_1 - s_2).norm();
+    Scalar e_s = (e_1 - s_2).norm();
+    Scalar s_s = (s_1 - s_2).norm();
 
     if (s_s < e_s) // we ned to reverse the curve
     {
@@ -57,14 +158,22 @@ void PolyCurve::insertAt(uint idx, std::shared_ptr<Curve>& curve)
     curves_[idx + 1]->manipulateControlPoint(0, (e_1 + s_2) / 2);
   }
 
+  watchCurve(*curve);
+  resetLengthsCache(idx > 0 ? idx - 1 : 0);
+  if (idx > 0)
+    updateBoundingBoxes(idx - 1);
+  if (idx + 1 < size())
+    updateBoundingBoxes(idx + 1);
+  updateBoundingBoxes(idx, 1);
   curves_.insert(curves_.begin() + idx, curve);
 }
 
-void PolyCurve::insertFront(std::shared_ptr<Curve>& curve) { insertAt(0, curve); }
+template <typename Scalar> void PolyCurveT<Scalar>::insertFront(std::shared_ptr<Curve>& curve) { insertAt(0, curve); }
 
-void PolyCurve::insertBack(std::shared_ptr<Curve>& curve) { insertAt(size(), curve); }
+template <typename Scalar>
+void PolyCurveT<Scalar>::insertBack(std::shared_ptr<Curve>& curve) { insertAt(size(), curve); }
 
-void PolyCurve::removeAt(uint idx)
+template <typename Scalar> void PolyCurveT<Scalar>::removeAt(uint idx)
 {
   if (idx == 0)
     removeFirst();
@@ -77,35 +186,194 @@ void PolyCurve::removeAt(uint idx)
     std::tie(s_2, e_2) = curves_[idx + 1]->endPoints();
     curves_[idx - 1]->manipulateControlPoint(curves_[idx - 1]->order(), (e_1 + s_2) / 2);
     curves_[idx + 1]->manipulateControlPoint(0, (e_1 + s_2) / 2);
+    resetLengthsCache(idx - 1);
+    updateBoundingBoxes(idx - 1);
+    updateBoundingBoxes(idx + 1);
+    updateBoundingBoxes(idx, -1);
     curves_.erase(curves_.begin() + idx);
   }
 }
 
-void PolyCurve::removeFirst() { curves_.pop_front(); }
+template <typename Scalar> void PolyCurveT<Scalar>::removeFirst()
+{
+  resetLengthsCache(0);
+  updateBoundingBoxes(0, -1);
+  curves_.pop_front();
+}
 
-void PolyCurve::removeBack() { curves_.pop_back(); }
+template <typename Scalar> void PolyCurveT<Scalar>::removeBack()
+{
+  resetLengthsCache(size() - 1);
+  updateBoundingBoxes(size() - 1, -1);
+  curves_.pop_back();
+}
 
-PolyCurve PolyCurve::subPolyCurve(uint idx_l, uint idx_r) const
+template <typename Scalar> PolyCurveT<Scalar> PolyCurveT<Scalar>::subPolyCurve(uint idx_l, uint idx_r) const
 {
-  return PolyCurve(std::deque<std::shared_ptr<Curve>>(curves_.begin() + idx_l, curves_.begin() + idx_r));
+  return PolyCurveT(std::deque<std::shared_ptr<Curve>>(curves_.begin() + idx_l, curves_.begin() + idx_r));
 }
 
-uint PolyCurve::size() const { return static_cast<uint>(curves_.size()); }
+template <typename Scalar> uint PolyCurveT<Scalar>::size() const { return static_cast<uint>(curves_.size()); }
 
-uint PolyCurve::curveIdx(double t) const
+template <typename Scalar> uint PolyCurveT<Scalar>::curveIdx(Scalar t) const
 {
   uint idx = static_cast<uint>(t);
   return idx - (idx == size());
 }
 
-std::shared_ptr<Curve> PolyCurve::curvePtr(uint idx) const { return curves_[idx]; }
+template <typename Scalar>
+std::shared_ptr<CurveT<Scalar>> PolyCurveT<Scalar>::curvePtr(uint idx) const { return curves_[idx]; }
+
+template <typename Scalar> void PolyCurveT<Scalar>::resetCache(uint idx)
+{
+  resetLengthsCache(idx);
+  for (uint k = idx; k < size(); k++)
+    updateBoundingBoxes(k);
+}
+
+template <typename Scalar> void PolyCurveT<Scalar>::resetLengthsCache(uint idx)
+{
+  // arc length to start of subcurve idx does not depend on it
+  auto cumulative_lengths = std::atomic_load(&cached_cumulative_lengths_);
+  if (cumulative_lengths && cumulative_lengths->versions.size() > idx)
+  {
+    auto new_cache = std::make_shared<LengthsCache>();
+    new_cache->lengths.assign(cumulative_lengths->lengths.begin(), cumulative_lengths->lengths.begin() + idx + 1);
+    new_cache->versions.assign(cumulative_lengths->versions.begin(), cumulative_lengths->versions.begin() + idx);
+    std::atomic_store(&cached_cumulative_lengths_, std::shared_ptr<const LengthsCache>(new_cache));
+  }
+}
+
+template <typename Scalar>
+std::shared_ptr<const typename PolyCurveT<Scalar>::LengthsCache> PolyCurveT<Scalar>::cumulativeLengths() const
+{
+  // stamp is loaded before cache, as it is published after the cache it was checked for
+  const std::size_t modifications = modifications_->load(std::memory_order_acquire);
+  const bool checked = lengths_checked_.load(std::memory_order_acquire) == modifications;
+  auto cumulative_lengths = std::atomic_load(&cached_cumulative_lengths_);
+  const bool complete = cumulative_lengths && cumulative_lengths->versions.size() == size();
+  if (complete && checked)
+    return cumulative_lengths;
+
+  // keep prefix of subcurves that were not modified since their lengths were computed
+  std::size_t valid = cumulative_lengths ? cumulative_lengths->versions.size() : 0;
+  for (std::size_t k = 0; k < valid; k++)
+    if (cumulative_lengths->versions[k] != curves_[k]->version_)
+      valid = k;
+  if (complete && valid == size())
+  {
+    lengths_checked_.store(modifications, std::memory_order_release);
+    return cumulative_lengths;
+  }
+
+  auto new_cache = std::make_shared<LengthsCache>();
+  new_cache->lengths.reserve(size() + 1);
+  new_cache->versions.reserve(size());
+  if (cumulative_lengths)
+  {
+    new_cache->lengths.assign(cumulative_lengths->lengths.begin(), cumulative_lengths->lengths.begin() + valid + 1);
+    new_cache->versions.assign(cumulative_lengths->versions.begin(), cumulative_lengths->versions.begin() + valid);
+  }
+  else
+    new_cache->lengths.push_back(0);
+  for (std::size_t k = valid; k < size(); k++)
+  {
+    new_cache->versions.push_back(curves_[k]->version_);
+    new_cache->lengths.push_back(new_cache->lengths.back() + curves_[k]->length());
+  }
+
+  cumulative_lengths = new_cache;
+  std::atomic_store(&cached_cumulative_lengths_, cumulative_lengths);
+  lengths_checked_.store(modifications, std::memory_order_release);
+  return cumulative_lengths;
+}
+
+template <typename Scalar> void PolyCurveT<Scalar>::updateBoundingBoxes(uint idx, int change)
+{
+  // cached boxes may be shared with copies, so they are copied before modification
+  for (auto* cache : {&cached_bounding_boxes_tight_, &cached_bounding_boxes_relaxed_})
+  {
+    auto bounding_boxes = std::atomic_load(cache);
+    if (!bounding_boxes)
+      continue;
+    auto new_cache = std::make_shared<BoundingBoxesCache>(*bounding_boxes);
+    if (change > 0)
+    {
+      new_cache->boxes.insert(new_cache->boxes.begin() + idx, BoundingBox());
+      new_cache->versions.insert(new_cache->versions.begin() + idx, 0);
+    }
+    else if (idx < new_cache->boxes.size())
+    {
+      if (change < 0)
+      {
+        new_cache->boxes.erase(new_cache->boxes.begin() + idx);
+        new_cache->versions.erase(new_cache->versions.begin() + idx);
+      }
+      else
+        new_cache->boxes[idx].setEmpty();
+    }
+    new_cache->merged.setEmpty();
+    std::atomic_store(cache, std::shared_ptr<const BoundingBoxesCache>(new_cache));
+  }
+}
+
+template <typename Scalar>
+std::shared_ptr<const typename PolyCurveT<Scalar>::BoundingBoxesCache>
+PolyCurveT<Scalar>::boundingBoxesCache(bool use_roots) const
+{
+  auto& cache = use_roots ? cached_bounding_boxes_tight_ : cached_bounding_boxes_relaxed_;
+  auto& cache_checked = use_roots ? bounding_boxes_tight_checked_ : bounding_boxes_relaxed_checked_;
+  // stamp is loaded before cache, as it is published after the cache it was checked for
+  const std::size_t modifications = modifications_->load(std::memory_order_acquire);
+  const bool checked = cache_checked.load(std::memory_order_acquire) == modifications;
+  auto bounding_boxes = std::atomic_load(&cache);
+  const bool complete = bounding_boxes && !bounding_boxes->merged.isEmpty();
+  if (complete && checked)
+    return bounding_boxes;
+
+  auto outdated = [this, &bounding_boxes](uint k) {
+    return bounding_boxes->boxes[k].isEmpty() || bounding_boxes->versions[k] != curves_[k]->version_;
+  };
+  if (complete && bounding_boxes->boxes.size() == size())
+  {
+    uint k = 0;
+    while (k < size() && !outdated(k))
+      k++;
+    if (k == size())
+    {
+      cache_checked.store(modifications, std::memory_order_release);
+      return bounding_boxes;
+    }
+  }
+
+  // get boxes only for subcurves that were modified
+  auto new_cache = bounding_boxes ? std::make_shared<BoundingBoxesCache>(*bounding_boxes)
+                                  : std::make_shared<BoundingBoxesCache>();
+  new_cache->boxes.resize(size());
+  new_cache->versions.resize(size());
+  new_cache->merged.setEmpty();
+  for (uint k = 0; k < size(); k++)
+  {
+    if (new_cache->boxes[k].isEmpty() || new_cache->versions[k] != curves_[k]->version_)
+    {
+      new_cache->boxes[k] = curves_[k]->boundingBox(use_roots);
+      new_cache->versions[k] = curves_[k]->version_;
+    }
+    new_cache->merged.extend(new_cache->boxes[k]);
+  }
+
+  bounding_boxes = new_cache;
+  std::atomic_store(&cache, bounding_boxes);
+  cache_checked.store(modifications, std::memory_order_release);
+  return bounding_boxes;
+}
 
-std::vector<std::shared_ptr<Curve>> PolyCurve::curveList() const
+template <typename Scalar> std::vector<std::shared_ptr<CurveT<Scalar>>> PolyCurveT<Scalar>::curveList() const
 {
   return std::vector<std::shared_ptr<Curve>>(curves_.begin(), curves_.end());
 }
 
-PointVector PolyCurve::polyline(double smoothness, double precision) const
+template <typename Scalar> PointVectorT<Scalar> PolyCurveT<Scalar>::polyline(Scalar smoothness, Scalar precision) const
 {
   PointVector polyline;
   for (uint k = 0; k < size(); k++)
@@ -117,60 +385,101 @@ PointVector PolyCurve::polyline(double smoothness, double precision) const
   return polyline;
 }
 
-double PolyCurve::length() const { return length(0, size()); }
+template <typename Scalar> Scalar PolyCurveT<Scalar>::length() const { return length(0, size()); }
 
-double PolyCurve::length(double t) const { return length(0, t); }
+template <typename Scalar> Scalar PolyCurveT<Scalar>::length(Scalar t) const { return length(0, t); }
 
-double PolyCurve::length(double t1, double t2) const
+template <typename Scalar> Scalar PolyCurveT<Scalar>::length(Scalar t1, Scalar t2) const
 {
   uint idx1 = curveIdx(t1);
   uint idx2 = curveIdx(t2);
 
   if (idx1 == idx2)
     return curves_[idx1]->length(t1 - idx1, t2 - idx2);
-  else if (idx1 + 1 == idx2)
-    return curves_[idx1]->length(t1 - idx1, 1.0) + curves_[idx2]->length(0.0, t2 - idx2);
-  else
-    return std::accumulate(begin(curves_) + idx1 + 1, begin(curves_) + idx2,
-                           curves_[idx1]->length(t1 - idx1, 1.0) + curves_[idx2]->length(0.0, t2 - idx2),
-                           [](double sum, std::shared_ptr<Curve> curve) { return sum + curve->length(); });
+
+  auto cumulative_lengths = cumulativeLengths();
+  return cumulative_lengths->lengths[idx2] - cumulative_lengths->lengths[idx1] + curves_[idx2]->length(0.0, t2 - idx2) -
+         curves_[idx1]->length(0.0, t1 - idx1);
 }
 
-double PolyCurve::iterateByLength(double t, double s, double epsilon, std::size_t max_iter) const
+template <typename Scalar> typename PolyCurveT<Scalar>::VectorX PolyCurveT<Scalar>::lengths() const
 {
-  double s_t = length(t);
+  auto cumulative_lengths = cumulativeLengths();
+  VectorX lengths(size());
+  for (uint k = 0; k < size(); k++)
+    lengths(k) = cumulative_lengths->lengths[k + 1] - cumulative_lengths->lengths[k];
+  return lengths;
+}
+
+template <typename Scalar>
+Scalar PolyCurveT<Scalar>::iterateByLength(Scalar t, Scalar s, Scalar epsilon, std::size_t max_iter) const
+{
+  auto cumulative_lengths = cumulativeLengths();
+  uint idx = curveIdx(t);
+  const Scalar s_t = cumulative_lengths->lengths[idx] + curves_[idx]->length(t - idx);
   //  if (s_t + s < 0 || s_t + s > length())
   //    throw std::out_of_range{"Resulting parameter t not in [0, n] range."};
   if (s_t + s < 0)
     return 0;
-  if (s_t + s > length())
+  if (s_t + s > cumulative_lengths->lengths.back())
     return size();
 
-  uint idx = curveIdx(t);
-  t -= idx;
-  s_t -= length(idx);
+  // binary search for subcurve containing the resulting length
+  const Scalar s_new = s_t + s;
+  auto it = std::upper_bound(cumulative_lengths->lengths.begin(), cumulative_lengths->lengths.end() - 1, s_new);
+  const uint new_idx = static_cast<uint>(it - cumulative_lengths->lengths.begin()) - 1;
 
-  bool first_iteration = true;
-  while (curvePtr(idx)->length() - s_t < s)
+  if (new_idx == idx)
+    return idx + curves_[idx]->iterateByLength(t - idx, s, epsilon, max_iter);
+  return new_idx +
+         curves_[new_idx]->iterateByLength(0, s_new - cumulative_lengths->lengths[new_idx], epsilon, max_iter);
+}
+
+template <typename Scalar>
+std::pair<typename PolyCurveT<Scalar>::VectorX, typename PolyCurveT<Scalar>::MatrixX2>
+PolyCurveT<Scalar>::resampleByLength(Scalar spacing, Scalar epsilon) const
+{
+  if (spacing <= 0)
+    throw std::invalid_argument{"Parameter 'spacing' must be positive."};
+
+  std::pair<VectorX, MatrixX2> samples;
+  const uint count = Curve::sampleCount(cumulativeLengths()->lengths.back(), spacing);
+  samples.first.resize(count);
+  samples.second.resize(count, 2);
+  const uint written = std::min(count, resampleByLength(spacing, samples.first, samples.second, epsilon));
+  samples.first.conservativeResize(written);
+  samples.second.conservativeResize(written, 2);
+  return samples;
+}
+
+template <typename Scalar>
+uint PolyCurveT<Scalar>::resampleByLength(Scalar spacing, Eigen::Ref<VectorX> t_vector, Eigen::Ref<MatrixX2> points,
+                                          Scalar epsilon) const
+{
+  const uint capacity = static_cast<uint>(std::min(t_vector.size(), points.rows()));
+  auto cumulative_lengths = cumulativeLengths();
+  uint count = 0;
+  for (uint idx = 0; idx < size(); idx++)
   {
-    s -= curvePtr(idx++)->length() - s_t;
-    if (first_iteration)
-    {
-      first_iteration = false;
-      s_t = 0;
-      t = 0;
-    }
+    // arc length from start of subcurve to the next sample, taken from cumulative lengths so rounding does not build up
+    const Scalar offset =
+        std::min(spacing, std::max(Scalar(0), count * spacing - cumulative_lengths->lengths[idx]));
+    const uint written = std::min(count, capacity);
+    const uint curve_count = curves_[idx]->resampleByLength(spacing, t_vector.segment(written, capacity - written),
+                                                            points.middleRows(written, capacity - written), offset,
+                                                            epsilon);
+    t_vector.segment(written, std::min(curve_count, capacity - written)).array() += idx;
+    count += curve_count;
   }
-
-  return idx + curvePtr(idx)->iterateByLength(t, s, epsilon, max_iter);
+  return count;
 }
 
-std::pair<Point, Point> PolyCurve::endPoints() const
+template <typename Scalar> std::pair<PointT<Scalar>, PointT<Scalar>> PolyCurveT<Scalar>::endPoints() const
 {
   return std::make_pair(curves_.front()->endPoints().first, curves_.back()->endPoints().second);
 }
 
-PointVector PolyCurve::controlPoints() const
+template <typename Scalar> PointVectorT<Scalar> PolyCurveT<Scalar>::controlPoints() const
 {
   PointVector cp;
   for (auto& curve_ptr : curves_)
@@ -182,75 +491,126 @@ PointVector PolyCurve::controlPoints() const
   return cp;
 }
 
-void PolyCurve::manipulateControlPoint(uint idx, const Point& point)
+template <typename Scalar> void PolyCurveT<Scalar>::manipulateControlPoint(uint idx, const Point& point)
 {
-  for (auto& curve_ptr : curves_)
-    if (idx <= curve_ptr->order())
+  for (uint k = 0; k < size(); k++)
+    if (idx <= curves_[k]->order())
     {
-      curve_ptr->manipulateControlPoint(idx, point);
+      curves_[k]->manipulateControlPoint(idx, point);
+      resetLengthsCache(k);
+      updateBoundingBoxes(k);
       break;
     }
     else
-      --idx -= curve_ptr->order();
+      --idx -= curves_[k]->order();
 }
 
-Point PolyCurve::valueAt(double t) const
+template <typename Scalar> PointT<Scalar> PolyCurveT<Scalar>::valueAt(Scalar t) const
 {
   uint idx = curveIdx(t);
   return curvePtr(idx)->valueAt(t - idx);
 }
 
-double PolyCurve::curvatureAt(double t) const
+template <typename Scalar>
+typename PolyCurveT<Scalar>::MatrixX2 PolyCurveT<Scalar>::valueAt(const VectorX& t_vector) const
+{
+  return evaluateGrouped(t_vector, [](const Curve& curve, const VectorX& t) { return curve.valueAt(t); });
+}
+
+template <typename Scalar> Scalar PolyCurveT<Scalar>::curvatureAt(Scalar t) const
 {
   uint idx = curveIdx(t);
   return curvePtr(idx)->curvatureAt(t - idx);
 }
 
-double PolyCurve::curvatureDerivativeAt(double t) const
+template <typename Scalar> Scalar PolyCurveT<Scalar>::curvatureDerivativeAt(Scalar t) const
 {
   uint idx = curveIdx(t);
   return curvePtr(idx)->curvatureDerivativeAt(t - idx);
 }
 
-Vector PolyCurve::tangentAt(double t, bool normalize) const
+template <typename Scalar>
+typename PolyCurveT<Scalar>::Functionals PolyCurveT<Scalar>::functionals(uint intervals) const
+{
+  Functionals result{0, 0, 0};
+  for (auto& curve_ptr : curves_)
+  {
+    Functionals curve_result = curve_ptr->functionals(intervals);
+    result.bending_energy += curve_result.bending_energy;
+    result.curvature_variation += curve_result.curvature_variation;
+    result.max_curvature = std::max(result.max_curvature, curve_result.max_curvature);
+  }
+  return result;
+}
+
+template <typename Scalar> VectorT<Scalar> PolyCurveT<Scalar>::tangentAt(Scalar t, bool normalize) const
 {
   uint idx = curveIdx(t);
   return curvePtr(idx)->tangentAt(t - idx, normalize);
 }
 
-Vector PolyCurve::normalAt(double t, bool normalize) const
+template <typename Scalar>
+typename PolyCurveT<Scalar>::MatrixX2 PolyCurveT<Scalar>::tangentAt(const VectorX& t_vector, bool normalize) const
+{
+  return evaluateGrouped(t_vector, [normalize](const Curve& curve, const VectorX& t) {
+    return curve.tangentAt(t, normalize);
+  });
+}
+
+template <typename Scalar> VectorT<Scalar> PolyCurveT<Scalar>::normalAt(Scalar t, bool normalize) const
 {
   uint idx = curveIdx(t);
   return curvePtr(idx)->normalAt(t - idx, normalize);
 }
 
-Point PolyCurve::derivativeAt(double t) const
+template <typename Scalar>
+typename PolyCurveT<Scalar>::MatrixX2 PolyCurveT<Scalar>::normalAt(const VectorX& t_vector, bool normalize) const
+{
+  return evaluateGrouped(t_vector, [normalize](const Curve& curve, const VectorX& t) {
+    return curve.normalAt(t, normalize);
+  });
+}
+
+template <typename Scalar> PointT<Scalar> PolyCurveT<Scalar>::derivativeAt(Scalar t) const
 {
   uint idx = curveIdx(t);
   return curvePtr(idx)->derivativeAt(t - idx);
 }
 
-Point PolyCurve::derivativeAt(uint n, double t) const
+template <typename Scalar>
+typename PolyCurveT<Scalar>::MatrixX2 PolyCurveT<Scalar>::derivativeAt(const VectorX& t_vector) const
+{
+  return evaluateGrouped(t_vector,
+                         [](const Curve& curve, const VectorX& t) { return curve.derivativeAt(t); });
+}
+
+template <typename Scalar> PointT<Scalar> PolyCurveT<Scalar>::derivativeAt(uint n, Scalar t) const
 {
   uint idx = curveIdx(t);
   return curvePtr(idx)->derivativeAt(n, t - idx);
 }
 
-BoundingBox PolyCurve::boundingBox(bool use_roots) const
+template <typename Scalar>
+typename PolyCurveT<Scalar>::MatrixX2 PolyCurveT<Scalar>::derivativeAt(uint n, const VectorX& t_vector) const
 {
-  BoundingBox bbox;
-  for (auto& curve_ptr : curves_)
-    bbox.extend(curve_ptr->boundingBox(use_roots));
-  return bbox;
+  return evaluateGrouped(t_vector,
+                         [n](const Curve& curve, const VectorX& t) { return curve.derivativeAt(n, t); });
 }
 
-// namespace is a workaround for a bug on old gcc versions:
-// https://stackoverflow.com/questions/25311512/specialization-of-template-in-different-namespace
-namespace Bezier
+template <typename Scalar> BoundingBoxT<Scalar> PolyCurveT<Scalar>::boundingBox(bool use_roots) const
 {
+  return boundingBoxesCache(use_roots)->merged;
+}
+
+template <typename Scalar>
+std::vector<BoundingBoxT<Scalar>> PolyCurveT<Scalar>::boundingBoxes(bool use_roots) const
+{
+  return boundingBoxesCache(use_roots)->boxes;
+}
 
-template <>
-PointVector PolyCurve::pointsOfIntersection<Curve>(const Curve& curve, bool stop_at_first, double epsilon) const
+template <typename Scalar>
+PointVectorT<Scalar> PolyCurveT<Scalar>::pointsOfIntersection(const Curve& curve, bool stop_at_first,
+                                                              Scalar epsilon) const
 {
   PointVector points;
   for (auto& curve_ptr : curves_)
@@ -264,9 +624,9 @@ PointVector PolyCurve::pointsOfIntersection<Curve>(const Curve& curve, bool stop
   return points;
 }
 
-template <>
-PointVector PolyCurve::pointsOfIntersection<PolyCurve>(const PolyCurve& poly_curve, bool stop_at_first,
-                                                       double epsilon) const
+template <typename Scalar>
+PointVectorT<Scalar> PolyCurveT<Scalar>::pointsOfIntersection(const PolyCurveT& poly_curve, bool stop_at_first,
+                                                              Scalar epsilon) const
 {
   PointVector points;
   for (auto& curve_ptr : curves_)
@@ -280,17 +640,20 @@ PointVector PolyCurve::pointsOfIntersection<PolyCurve>(const PolyCurve& poly_cur
   return points;
 }
 
-} // namespace Bezier
-
-double PolyCurve::projectPoint(const Point& point, double step, double epsilon) const
+template <typename Scalar>
+Scalar PolyCurveT<Scalar>::projectPoint(const Point& point, Scalar step, Scalar epsilon) const
 {
-  double min_t = curves_.front()->projectPoint(point, step, epsilon);
-  double min_dist = (point - curves_.front()->valueAt(min_t)).norm();
+  Scalar min_t = curves_.front()->projectPoint(point, step, epsilon);
+  Scalar min_dist = (point - curves_.front()->valueAt(min_t)).norm();
 
   for (uint k = 1; k < size(); k++)
   {
-    double t = curves_[k]->projectPoint(point, step, epsilon);
-    double dist = (point - curves_[k]->valueAt(t)).norm();
+    // subcurve lies within convex hull of its control points, skip it if hull is further than best projection
+    if (distanceToPolygon(point, curves_[k]->convexHull()) >= min_dist)
+      continue;
+
+    Scalar t = curves_[k]->projectPoint(point, step, epsilon);
+    Scalar dist = (point - curves_[k]->valueAt(t)).norm();
     if (dist < min_dist)
     {
       min_dist = dist;
@@ -299,3 +662,9 @@ double PolyCurve::projectPoint(const Point& point, double step, double epsilon)
   }
   return min_t;
 }
+
+namespace Bezier
+{
+template class PolyCurveT<double>;
+template class PolyCurveT<float>;
+} // namespace Bezier
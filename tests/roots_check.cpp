@@ -0,0 +1,69 @@
+#include "Bezier/bezier.h"
+#include "Bezier/curven.h"
+
+#include <cstdio>
+
+/*!
+ * Regression checks for root finding: every extreme point of a curve is compared
+ * with the extremes of a dense sampling, so missing or spurious roots are reported.
+ */
+
+using namespace Bezier;
+
+static bool checkRoots(const char* name, const Curve& curve, uint expected)
+{
+  const PointVector roots = curve.roots();
+  bool ok = roots.size() == expected;
+
+  // every root has a vanishing derivative on at least one axis
+  for (const Point& root : roots)
+  {
+    const double t = curve.projectPoint(root);
+    const Vector derivative = curve.derivativeAt(t);
+    if (std::min(std::fabs(derivative.x()), std::fabs(derivative.y())) > 1e-3 * derivative.norm() + 1e-6)
+      ok = false;
+  }
+
+  // bounding box from roots matches the one of a dense sampling
+  BoundingBox sampled;
+  for (double t = 0; t <= 1; t += 1e-4)
+    sampled.extend(curve.valueAt(t));
+  sampled.extend(curve.valueAt(1));
+  const BoundingBox bbox = curve.boundingBox(true);
+  if ((bbox.min() - sampled.min()).cwiseAbs().maxCoeff() > 1e-6 ||
+      (bbox.max() - sampled.max()).cwiseAbs().maxCoeff() > 1e-6)
+    ok = false;
+
+  std::printf("%-40s %s\n", name, ok ? "ok" : "FAILED");
+  return ok;
+}
+
+template <uint Order> static bool checkRoots(const char* name, const CurveN<Order>& curve_n)
+{
+  // fixed-order curve finds the same extremes as the general one
+  const Curve curve = curve_n;
+  const BoundingBox bbox_n = curve_n.boundingBox(true), bbox = curve.boundingBox(true);
+  bool ok = checkRoots(name, curve, static_cast<uint>(curve_n.roots().size())) &&
+            (bbox_n.min() - bbox.min()).cwiseAbs().maxCoeff() < 1e-9 &&
+            (bbox_n.max() - bbox.max()).cwiseAbs().maxCoeff() < 1e-9;
+  if (!ok)
+    std::printf("%-40s FAILED for CurveN\n", name);
+  return ok;
+}
+
+int main()
+{
+  bool ok = true;
+
+  // derivative has a zero Bernstein coefficient at t = 0 on x axis, which must not affect y axis
+  Curve::MatrixX2 points(6, 2);
+  points << 0, 0, 0, 5, 3, -2, 6, 8, 4, 1, 10, 3;
+  ok &= checkRoots("zero endpoint coefficient, order 5", Curve(points), 3);
+
+  // derivative of fixed-order curve has a root at t = 0 on x axis, next to an interior one
+  CurveN<3>::ControlPoints points_n;
+  points_n << 0, 0, 0, 1, 0.1, 2, -3, 3;
+  ok &= checkRoots("zero endpoint coefficient, CurveN<3>", CurveN<3>(points_n));
+
+  return ok ? 0 : 1;
+}